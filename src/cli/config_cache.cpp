@@ -0,0 +1,138 @@
+#include "config_cache.h"
+#include "../runtime/git_sha1.h"
+
+#include <fstream>
+#include <cstring>
+#include <filesystem>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+static const uint64_t cache_magic = 0x31434d5646515300; // \0SQFVMC1
+
+static uint64_t fnv1a(std::string_view data, uint64_t hash = 14695981039346656037ULL)
+{
+    for (auto c : data)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+static uint64_t hash_file(const std::string& physical_path)
+{
+    auto file = sqf::runtime::fileio::read_file_from_disk(physical_path);
+    return file.has_value() ? fnv1a(*file) : 0;
+}
+template<typename T>
+static void write_raw(std::ostream& out, const T& val)
+{
+    out.write(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+template<typename T>
+static bool read_raw(std::string_view& data, T& val)
+{
+    if (data.length() < sizeof(T))
+    {
+        return false;
+    }
+    std::memcpy(&val, data.data(), sizeof(T));
+    data.remove_prefix(sizeof(T));
+    return true;
+}
+
+config_cache::config_cache(std::string path, const std::vector<std::string>& config_files, const std::vector<std::string>& defines, const std::vector<std::string>& mappings) :
+    m_path(std::move(path)),
+    m_key(fnv1a(g_GIT_SHA1)),
+    m_dependencies()
+{
+    for (auto& file : config_files)
+    {
+        m_key = fnv1a(file, m_key);
+        m_key ^= hash_file(file);
+    }
+    for (auto& define : defines)
+    {
+        m_key = fnv1a(define, fnv1a("-D", m_key));
+    }
+    for (auto& mapping : mappings)
+    {
+        m_key = fnv1a(mapping, fnv1a("-v", m_key));
+    }
+}
+
+bool config_cache::load(sqf::runtime::runtime& runtime) const
+{
+    auto mapped = sqf::runtime::fileio::map_file_from_disk(m_path);
+    if (!mapped)
+    {
+        return false;
+    }
+    auto data = mapped->contents();
+    uint64_t magic;
+    uint64_t key;
+    uint32_t dependencies;
+    if (!read_raw(data, magic) || magic != cache_magic ||
+        !read_raw(data, key) || key != m_key ||
+        !read_raw(data, dependencies))
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < dependencies; i++)
+    {
+        uint32_t length;
+        uint64_t hash;
+        if (!read_raw(data, length) || data.length() < length)
+        {
+            return false;
+        }
+        std::string physical(data.substr(0, length));
+        data.remove_prefix(length);
+        if (!read_raw(data, hash) || hash != hash_file(physical))
+        {
+            return false;
+        }
+    }
+    return runtime.confighost().read_image(data, mapped);
+}
+
+bool config_cache::save(sqf::runtime::runtime& runtime) const
+{
+    auto temporary = m_path + ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out.good())
+        {
+            return false;
+        }
+        write_raw(out, cache_magic);
+        write_raw(out, m_key);
+        write_raw(out, static_cast<uint32_t>(m_dependencies.size()));
+        for (auto& physical : m_dependencies)
+        {
+            write_raw(out, static_cast<uint32_t>(physical.length()));
+            out.write(physical.data(), static_cast<std::streamsize>(physical.length()));
+            write_raw(out, hash_file(physical));
+        }
+        runtime.confighost().write_image(out);
+        out.close();
+        if (!out.good())
+        {
+            std::error_code ec;
+            std::filesystem::remove(temporary, ec);
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temporary, m_path, ec);
+    if (ec)
+    {
+        std::filesystem::remove(temporary, ec);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "../runtime/runtime.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+/// <summary>
+/// Cache of the loaded configs, used by the `--config-cache` CLI argument.
+/// Stores a confighost image (see confighost::write_image) together with what it was created from:
+/// The key, hashing the input config files, defines and virtual path mappings, and the hashes of all files included while preprocessing them.
+/// </summary>
+class config_cache
+{
+    std::string m_path;
+    uint64_t m_key;
+    std::vector<std::string> m_dependencies;
+
+public:
+    config_cache(std::string path, const std::vector<std::string>& config_files, const std::vector<std::string>& defines, const std::vector<std::string>& mappings);
+
+    /// <summary>
+    /// Adds files the configs depend on (eg. includes), a modification of them invalidates the cache.
+    /// </summary>
+    void add_dependencies(const std::vector<std::string>& physical_paths) { m_dependencies.insert(m_dependencies.end(), physical_paths.begin(), physical_paths.end()); }
+
+    /// <summary>
+    /// Loads the cache into the (empty) confighost of the runtime.
+    /// </summary>
+    /// <returns>false if there is no cache or it is outdated.</returns>
+    bool load(sqf::runtime::runtime& runtime) const;
+
+    /// <summary>
+    /// Writes the current confighost of the runtime into the cache.
+    /// The image is written to a temporary file first and then renamed over the cache,
+    /// other processes having the previous cache mapped keep reading the old file.
+    /// </summary>
+    /// <returns>false if the cache could not be written.</returns>
+    bool save(sqf::runtime::runtime& runtime) const;
+};
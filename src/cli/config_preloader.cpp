@@ -0,0 +1,120 @@
+#include "config_preloader.h"
+#include "../parser/config/config_parser.hpp"
+
+#include <algorithm>
+
+config_preloader::config_preloader(
+    sqf::runtime::runtime& runtime,
+    const sqf::parser::preprocessor::impl_default& preprocessor,
+    const std::vector<std::string>& physical_files,
+    const Logger& logger,
+    size_t thread_count) :
+    m_files(),
+    m_done(physical_files.size(), false),
+    m_threads(),
+    m_next(0),
+    m_runtime(runtime),
+    m_preprocessor(preprocessor)
+{
+    for (auto& physical : physical_files)
+    {
+        m_files.push_back(std::make_unique<file>(physical, logger));
+    }
+    if (thread_count == 0)
+    {
+        thread_count = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    thread_count = std::min(thread_count, m_files.size());
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        m_threads.emplace_back([this]() { work(); });
+    }
+}
+
+config_preloader::~config_preloader()
+{
+    {
+        // Stop handing out files that nobody is going to wait for
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_next = m_files.size();
+    }
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+void config_preloader::work()
+{
+    while (true)
+    {
+        size_t index;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_next >= m_files.size())
+            {
+                return;
+            }
+            index = m_next++;
+        }
+
+        auto& f = *m_files[index];
+        try
+        {
+            auto contents = sqf::runtime::fileio::read_file_from_disk(f.physical);
+            if (!contents.has_value())
+            {
+                f.error = "";
+            }
+            else if (sqf::parser::config::parser::is_rapified(*contents))
+            { // Rapified configs (eg. config.bin) are binary and already preprocessed
+                f.contents = std::move(contents);
+            }
+            else
+            {
+                bool eval_deferred = false;
+                f.contents = m_preprocessor.preprocess(m_runtime, *contents, { f.physical, {} }, &f.included, nullptr, f.log, &eval_deferred);
+                if (eval_deferred)
+                { // Messages and includes are collected again when preprocessing it for real
+                    f.log.clear();
+                    f.included.clear();
+                    f.deferred = std::move(contents);
+                }
+            }
+        }
+        catch (const std::runtime_error& ex)
+        {
+            f.contents.reset();
+            f.error = ex.what();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_done[index] = true;
+        }
+        m_condition.notify_all();
+    }
+}
+
+config_preloader::file& config_preloader::get(size_t index)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this, index]() { return m_done[index]; });
+    lock.unlock();
+
+    auto& f = *m_files[index];
+    if (f.deferred.has_value())
+    {
+        try
+        {
+            f.contents = m_preprocessor.preprocess(m_runtime, *f.deferred, { f.physical, {} }, &f.included, nullptr, f.log, nullptr);
+        }
+        catch (const std::runtime_error& ex)
+        {
+            f.contents.reset();
+            f.error = ex.what();
+        }
+        f.deferred.reset();
+    }
+    return f;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include "../runtime/runtime.h"
+#include "../parser/preprocessor/default.h"
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/// <summary>
+/// Reads and preprocesses the config files passed to the CLI on a pool of worker threads.
+/// Files are handed out in their original order, so the caller can parse and apply them to the confighost
+/// in the defined order while the following files are still being preprocessed.
+/// Files using __EVAL or __EXEC are preprocessed when handed out instead, on the calling thread,
+/// as the expressions run in the runtime and may depend on the configs applied before.
+/// The same goes for files using __COUNTER__ or __COUNTER_RESET__, so they count in the defined order.
+/// </summary>
+class config_preloader
+{
+public:
+    struct file
+    {
+        std::string physical;
+        // Preprocessed contents (or the raw contents of rapified configs). Empty if loading or preprocessing failed.
+        std::optional<std::string> contents;
+        // Set if the file could not be read at all.
+        std::optional<std::string> error;
+        // Files included while preprocessing.
+        std::vector<std::string> included;
+        // Messages logged while preprocessing, flushed into the actual logger by the caller.
+        BufferedLogger log;
+        // Raw contents of a file that has to be preprocessed on the thread owning the runtime (see get).
+        std::optional<std::string> deferred;
+
+        file(std::string physical, const Logger& logger) : physical(std::move(physical)), contents(), error(), included(), log(logger), deferred() {}
+    };
+
+private:
+    std::vector<std::unique_ptr<file>> m_files;
+    std::vector<bool> m_done;
+    std::vector<std::thread> m_threads;
+    size_t m_next;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    sqf::runtime::runtime& m_runtime;
+    const sqf::parser::preprocessor::impl_default& m_preprocessor;
+
+    void work();
+
+public:
+    /// <summary>
+    /// Starts loading the provided physical files using up to thread_count threads (0 picks the number of cores).
+    /// The preprocessor must not be modified until the preloader got destroyed.
+    /// </summary>
+    config_preloader(
+        sqf::runtime::runtime& runtime,
+        const sqf::parser::preprocessor::impl_default& preprocessor,
+        const std::vector<std::string>& physical_files,
+        const Logger& logger,
+        size_t thread_count = 0);
+    ~config_preloader();
+    config_preloader(const config_preloader&) = delete;
+    config_preloader& operator=(const config_preloader&) = delete;
+
+    size_t size() const { return m_files.size(); }
+
+    /// <summary>
+    /// Blocks until the file at the provided index is loaded.
+    /// Deferred files get preprocessed by this call, which thus has to happen on the thread owning the runtime.
+    /// </summary>
+    file& get(size_t index);
+};
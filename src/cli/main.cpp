@@ -16,6 +16,8 @@
 #endif
 
 #include "interactive_helper.h"
+#include "config_cache.h"
+#include "config_preloader.h"
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -183,7 +185,7 @@ int main_actual(int argc, char** argv)
     TCLAP::ValueArg<long> maxRuntimeArg("m", "max-runtime", "Sets the maximum allowed runtime for the VM. 0 means no restriction in place.", false, 0, "MILLISECONDS");
     cmd.add(maxRuntimeArg);
 
-    TCLAP::MultiArg<std::string> inputArg("i", "input", "Loads provided file from disk. File-Type is determined using default file extensions (sqf, cpp, hpp, pbo). " RELPATHHINT "!BE AWARE! This is case-sensitive!", false, "PATH");
+    TCLAP::MultiArg<std::string> inputArg("i", "input", "Loads provided file from disk. File-Type is determined using default file extensions (sqf, cpp, hpp, bin, pbo). " RELPATHHINT "!BE AWARE! This is case-sensitive!", false, "PATH");
     cmd.add(inputArg);
 
     TCLAP::MultiArg<std::string> inputSqfArg("", "input-sqf", "Loads provided SQF file from disk. Will be executed as if it was spawned. Executed from left to right. " RELPATHHINT "!BE AWARE! This is case-sensitive!", false, "PATH");
@@ -249,6 +251,19 @@ int main_actual(int argc, char** argv)
     TCLAP::SwitchArg noOperatorsArg("", "no-operators", "If provided, SQF-VM will not be loaded using the default set of operators it comes with (except for SQF-VM specific operators).", false);
     cmd.add(noOperatorsArg);
 
+    TCLAP::SwitchArg noBytecodeArg("", "no-bytecode", "Executes instructions one by one instead of using the lowered, flat bytecode representation. Mostly useful for debugging and benchmarking.", false);
+    cmd.add(noBytecodeArg);
+
+    TCLAP::ValueArg<std::string> configCacheArg("", "config-cache", "Caches the loaded config files in a binary image at the provided path. "
+        "If the image is up to date (same config files, includes and defines), it is loaded instead of preprocessing and parsing the config files again. " RELPATHHINT, false, "", "PATH");
+    cmd.add(configCacheArg);
+
+    TCLAP::SwitchArg resolveConfigArg("", "resolve-config", "Flattens the config after loading, making lookups of inherited config entries a single search at the cost of memory. Useful for config heavy scripts.", false);
+    cmd.add(resolveConfigArg);
+
+    TCLAP::SwitchArg virtualTimeArg("", "virtual-time", "Skips ahead to the next wakeup whenever all scripts are suspended instead of waiting for it. time, diag_tickTime and sleep follow that virtual clock, making sleep-heavy scripts finish quickly while keeping their relative order.", false);
+    cmd.add(virtualTimeArg);
+
 
 
     // TCLAP::MultiArg<std::string> loadArg("l", "load", "Adds provided path to the allowed locations list. " RELPATHHINT "\n"
@@ -426,7 +441,7 @@ int main_actual(int argc, char** argv)
         {
             sqf_files.push_back(f);
         }
-        else if (ext == "cpp" || ext == "hpp" || ext == "ext")
+        else if (ext == "cpp" || ext == "hpp" || ext == "ext" || ext == "bin")
         {
             config_files.push_back(f);
         }
@@ -457,12 +472,16 @@ int main_actual(int argc, char** argv)
     conf.enable_classname_check = enableClassnameCheckArg.getValue();
     conf.print_context_work_to_log_on_exit = !noWrokPrintArg.getValue();
     conf.max_runtime = std::chrono::milliseconds(maxRuntimeArg.getValue());
+    conf.disable_bytecode = noBytecodeArg.getValue();
+    conf.virtual_time = virtualTimeArg.getValue();
     
 
     sqf::runtime::runtime runtime(logger, conf);
     runtime.fileio(std::make_unique<sqf::fileio::impl_default>(logger));
     runtime.parser_config(std::make_unique<sqf::parser::config::parser>(logger));
-    runtime.parser_preprocessor(std::make_unique<sqf::parser::preprocessor::impl_default>(logger));
+    auto preprocessor = std::make_unique<sqf::parser::preprocessor::impl_default>(logger);
+    auto& preprocessor_default = *preprocessor;
+    runtime.parser_preprocessor(std::move(preprocessor));
 #if defined(SQF_SQC_SUPPORT)
     if (useSqcArg.getValue())
     {
@@ -505,9 +524,12 @@ int main_actual(int argc, char** argv)
 
 
     // Prepare Virtual-File-System
+    // Mappings are remembered as they change how configs resolve their includes (see config_cache).
+    std::vector<std::string> virtual_mappings;
     if (!noLoadExecDir)
     {
         runtime.fileio().add_mapping(executable_path, "/");
+        virtual_mappings.push_back(executable_path + "|/");
     }
     // for (auto& f : loadArg.getValue())
     // {
@@ -545,6 +567,7 @@ int main_actual(int argc, char** argv)
             phys = (std::filesystem::path(executable_path) / phys).lexically_normal().string();
         }
         runtime.fileio().add_mapping(phys, virt);
+        virtual_mappings.push_back(phys + "|" + virt);
         if (verbose)
         {
             std::cout << "Mapped '" << virt << "' onto '" << phys << "'." << std::endl;
@@ -594,6 +617,7 @@ int main_actual(int argc, char** argv)
             runtime.parser_preprocessor().push_back({ d.substr(0, eqIndex), d.substr(eqIndex + 1) });
         }
     }
+    preprocessor_default.freeze_macros();
 
     if (errflag)
     {
@@ -852,64 +876,101 @@ int main_actual(int argc, char** argv)
         }
     }
 
-    // Load & merge all config-files provided via arg.
-    for (auto& f : config_files)
+    // Load the config-files from cache if possible.
+    std::optional<config_cache> configs_cache;
+    if (configCacheArg.isSet() && !parseOnly)
     {
-        auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / f).lexically_normal()).string();
-        try
+        std::vector<std::string> physical_files;
+        for (auto& f : config_files)
+        {
+            physical_files.push_back(std::filesystem::absolute((std::filesystem::path(executable_path) / f).lexically_normal()).string());
+        }
+        configs_cache.emplace(arg_file_actual_path(executable_path, configCacheArg.getValue()), physical_files, defineArg.getValue(), virtual_mappings);
+        if (configs_cache->load(runtime))
         {
-            if (sanitized.empty())
-            {
-                continue;
-            }
             if (verbose)
             {
-                std::cout << "Loading file '" << sanitized << "' for config processing ..." << std::endl;
+                std::cout << "Loaded config files from cache '" << configCacheArg.getValue() << "'." << std::endl;
             }
-            auto file = sqf::runtime::fileio::read_file_from_disk(sanitized);
-            if (!file.has_value())
+            config_files.clear();
+            configs_cache.reset();
+        }
+    }
+
+    // Load & merge all config-files provided via arg.
+    // Files are read and preprocessed concurrently, parsing applies them to the confighost and thus happens in order.
+    std::vector<std::string> physical_config_files;
+    for (auto& f : config_files)
+    {
+        auto sanitized = std::filesystem::absolute((std::filesystem::path(executable_path) / f).lexically_normal()).string();
+        if (!sanitized.empty())
+        {
+            physical_config_files.push_back(sanitized);
+        }
+    }
+    if (verbose && !physical_config_files.empty())
+    {
+        std::cout << "Preprocessing " << physical_config_files.size() << " file(s) for config processing ..." << std::endl;
+    }
+    config_preloader preloader(runtime, preprocessor_default, physical_config_files, logger);
+    for (size_t i = 0; i < preloader.size(); i++)
+    {
+        auto& file = preloader.get(i);
+        auto& sanitized = file.physical;
+        file.log.flush(logger);
+        if (file.error.has_value())
+        {
+            errflag = true;
+            if (file.error->empty())
             {
                 std::cout << "Failed to load file '" << sanitized << "'" << std::endl;
-                errflag = true;
-                continue;
-            }
-            auto str = *file;
-            if (verbose)
-            {
-                std::cout << "Preprocessing file '" << sanitized << std::endl;
             }
-            auto ppedStr = runtime.parser_preprocessor().preprocess(runtime, str, { sanitized, {} });
-            if (ppedStr.has_value())
+            else
             {
-                if (verbose)
-                {
-                    std::cout << "Parsing file '" << sanitized << std::endl;
-                }
-                if (parseOnlyArg.getValue())
-                {
-                    auto success = !runtime.parser_config().check_syntax(*ppedStr, { sanitized, {} });
-                    errflag = !success;
-                }
-                else
-                {
-                    auto success = runtime.parser_config().parse(runtime.confighost(), *ppedStr, { sanitized, {} });
-                    if (!success)
-                    {
-                        errflag = true;
-                        std::cout << "Failed to parse file '" << sanitized << "'" << std::endl;
-                    }
-                }
+                std::cout << "Failed to load file '" << sanitized << "': " << *file.error << std::endl;
             }
-            else
+            continue;
+        }
+        if (configs_cache.has_value())
+        {
+            configs_cache->add_dependencies(file.included);
+        }
+        if (!file.contents.has_value())
+        {
+            errflag = true;
+            std::cout << "Failed to preprocess file '" << sanitized << "'" << std::endl;
+            continue;
+        }
+        if (verbose)
+        {
+            std::cout << "Parsing file '" << sanitized << std::endl;
+        }
+        if (parseOnlyArg.getValue() && !sqf::parser::config::parser::is_rapified(*file.contents))
+        {
+            auto success = !runtime.parser_config().check_syntax(*file.contents, { sanitized, {} });
+            errflag = !success;
+        }
+        else
+        {
+            auto success = runtime.parser_config().parse(runtime.confighost(), *file.contents, { sanitized, {} });
+            if (!success)
             {
                 errflag = true;
-                std::cout << "Failed to preprocess file '" << sanitized << "'" << std::endl;
+                std::cout << "Failed to parse file '" << sanitized << "'" << std::endl;
             }
         }
-        catch (const std::runtime_error& ex)
+        // Release the contents early, later files may still be loading
+        file.contents.reset();
+    }
+    if (configs_cache.has_value() && !errflag)
+    {
+        if (!configs_cache->save(runtime))
         {
-            errflag = true;
-            std::cout << "Failed to load file '" << sanitized << "': " << ex.what() << std::endl;
+            std::cout << "Failed to write config cache '" << configCacheArg.getValue() << "'." << std::endl;
+        }
+        else if (verbose)
+        {
+            std::cout << "Wrote config files to cache '" << configCacheArg.getValue() << "'." << std::endl;
         }
     }
     if (errflag || parseOnly)
@@ -961,6 +1022,10 @@ int main_actual(int argc, char** argv)
             std::cout << "Failed to parse commandline input." << std::endl;
         }
     }
+    if (resolveConfigArg.getValue())
+    {
+        runtime.confighost().resolve();
+    }
 //     if (serverArg.isSet())
 //     {
 //         networking_init();
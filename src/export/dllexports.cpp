@@ -71,6 +71,7 @@ namespace dllexports
         auto durationCasted = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
         conf.max_runtime = durationCasted;
         conf.disable_sleep = false;
+        conf.virtual_time = false;
         conf.enable_classname_check = true;
         conf.disable_networking = true;
         conf.print_context_work_to_log_on_exit = true;
@@ -146,6 +147,47 @@ extern "C" {
             return instance_invalid;
         }
     }
+    DLLEXPORT_PREFIX int32_t sqfvm_share_config(void* source, void* target)
+    {
+        const int32_t source_invalid = -1;
+        const int32_t target_invalid = -2;
+        const int32_t target_running = -3;
+        const int32_t source_running = -4;
+        const int32_t result_ok = 0;
+        std::shared_ptr<const sqf::runtime::confighost::snapshot> snapshot;
+        auto source_result = dllexports::with_instance_do(source, [&](dllexports::instance& ref) -> int32_t {
+            if (ref.runtime->runtime_state() != sqf::runtime::runtime::state::empty)
+            {
+                return source_running;
+            }
+            snapshot = ref.runtime->confighost().freeze();
+            return result_ok;
+        });
+        if (!source_result.has_value())
+        {
+            return source_invalid;
+        }
+        if (source_result.value() != result_ok)
+        {
+            return source_result.value();
+        }
+        auto result = dllexports::with_instance_do(target, [&](dllexports::instance& ref) -> int32_t {
+            if (ref.runtime->runtime_state() != sqf::runtime::runtime::state::empty)
+            {
+                return target_running;
+            }
+            ref.runtime->confighost().use_snapshot(snapshot);
+            return result_ok;
+        });
+        if (result.has_value())
+        {
+            return result.value();
+        }
+        else
+        {
+            return target_invalid;
+        }
+    }
     DLLEXPORT_PREFIX int32_t sqfvm_call(void* instance, void* call_data, char type, const char* code, uint32_t length)
     {
         const int32_t instance_invalid = -1;
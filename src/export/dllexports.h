@@ -42,6 +42,18 @@ extern "C" {
     //         -3 if parsing failed
     DLLEXPORT_PREFIX int32_t sqfvm_load_config(void* instance, const char* contents, uint32_t length);
 
+    // Replaces the config tree of the target instance with the one of the source instance.
+    // The config of the source gets frozen into an immutable snapshot that both instances reference,
+    // changes made afterwards (eg. by sqfvm_load_config) only affect the instance they are made on.
+    // @param source A valid instance as returned from sqfvm_create_instance
+    // @param target A valid instance as returned from sqfvm_create_instance
+    // @return  0 if the config was shared successfully,
+    //         -1 if the source was null
+    //         -2 if the target was null
+    //         -3 if the target is currently running
+    //         -4 if the source is currently running
+    DLLEXPORT_PREFIX int32_t sqfvm_share_config(void* source, void* target);
+
     // Checks the status of the instance
     // @param instance A valid instance as returned from sqfvm_create_instance
     // @return -1 if the instance was null
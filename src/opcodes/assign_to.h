@@ -3,9 +3,11 @@
 #include "../runtime/value.h"
 #include "../runtime/data.h"
 #include "../runtime/runtime.h"
+#include "../runtime/value_scope.h"
 
 #include <string>
 #include <string_view>
+#include <optional>
 
 namespace sqf::opcodes
 {
@@ -16,49 +18,87 @@ namespace sqf::opcodes
         std::string ___TYPE = "assign_to";
 #endif
         std::string m_variable_name;
+        // Lowercased variable name, computed once so lookups do not have to copy and transform it.
+        std::string m_variable_key;
 
-    public:
-        assign_to(std::string value) : m_variable_name(value) {}
-        assign_to(std::string_view value) : m_variable_name(value.begin(), value.end()) {}
-        virtual void execute(sqf::runtime::runtime& vm) const override
+        /// <summary>
+        /// Pops the value to assign, logging the same diagnostics for all forms of the instruction.
+        /// </summary>
+        static std::optional<sqf::runtime::value> pop_value(sqf::runtime::runtime& vm, const sqf::runtime::instruction& source, const std::string& variable_name)
         {
             auto& context = vm.context_active();
 
-            auto value = vm.context_active().pop_value();
+            auto value = context.pop_value();
             if (!value.has_value())
             {
                 if (context.weak_error_handling())
                 {
-                    vm.__logmsg(logmessage::runtime::FoundNoValueWeak(diag_info()));
+                    vm.__logmsg(logmessage::runtime::FoundNoValueWeak(source.diag_info()));
                 }
                 else
                 {
-                    vm.__logmsg(logmessage::runtime::FoundNoValue(diag_info()));
+                    vm.__logmsg(logmessage::runtime::FoundNoValue(source.diag_info()));
                 }
-                return;
             }
             else if (value->is<sqf::types::t_nothing>())
             {
-                vm.__logmsg(logmessage::runtime::AssigningNilValue(diag_info(), m_variable_name));
+                vm.__logmsg(logmessage::runtime::AssigningNilValue(source.diag_info(), variable_name));
             }
-            if (m_variable_name.empty()) { return; }
-            if (m_variable_name[0] == '_')
+            return value;
+        }
+
+    public:
+        assign_to(std::string value) : m_variable_name(value), m_variable_key(sqf::runtime::value_scope::to_key(value)) {}
+        assign_to(std::string_view value) : assign_to(std::string(value.begin(), value.end())) {}
+        /// <summary>
+        /// Executes the instruction with the provided operands. Used by execute and by the flat dispatch of lowered programs.
+        /// source is only used for diagnostics.
+        /// </summary>
+        static void execute(sqf::runtime::runtime& vm, const sqf::runtime::instruction& source, const std::string& variable_name, const std::string& variable_key)
+        {
+            auto& context = vm.context_active();
+
+            auto value = pop_value(vm, source, variable_name);
+            if (!value.has_value()) { return; }
+            if (variable_name.empty()) { return; }
+            if (variable_name[0] == '_')
             {
                 for (auto it = context.frames_rbegin(); it != context.frames_rend(); ++it)
                 {
-                    if (it->contains(m_variable_name))
+                    if (auto existing = it->find_key(variable_key))
                     {
-                        (*it)[m_variable_name] = *value;
+                        *existing = *value;
                         return;
                     }
                 }
-                context.current_frame()[m_variable_name] = *value;
+                context.current_frame().at_key(variable_key) = *value;
+            }
+            else
+            {
+                context.current_frame().globals_value_scope()->at_key(variable_key) = *value;
+            }
+        }
+        /// <summary>
+        /// Same as execute, but for a local variable lowered to a slot of the program running in the current frame (see bytecode::program::local).
+        /// </summary>
+        static void execute_local(sqf::runtime::runtime& vm, const sqf::runtime::instruction& source, uint32_t slot, const std::string& variable_name, const std::string& variable_key)
+        {
+            auto& context = vm.context_active();
+
+            auto value = pop_value(vm, source, variable_name);
+            if (!value.has_value()) { return; }
+            if (auto existing = context.find_local_slot(slot, variable_key, true))
+            {
+                *existing = *value;
             }
             else
             {
-                context.current_frame().globals_value_scope()->at(m_variable_name) = *value;
+                auto& variable = context.current_frame().at_key(variable_key);
+                variable = *value;
+                context.current_frame().local_slot(slot, &variable, true);
             }
         }
+        virtual void execute(sqf::runtime::runtime& vm) const override { execute(vm, *this, m_variable_name, m_variable_key); }
         virtual std::string to_string() const override { return std::string("ASSIGNTO ") + m_variable_name; }
         std::string_view variable_name() const { return m_variable_name; }
 
@@ -84,5 +124,17 @@ namespace sqf::opcodes
             auto casted = dynamic_cast<const assign_to*>(p_other);
             return casted != nullptr && casted->m_variable_name == m_variable_name;
         }
+
+        virtual void lower(sqf::runtime::bytecode::program& program) const override
+        {
+            if (!m_variable_name.empty() && m_variable_name[0] == '_')
+            {
+                program.emit(sqf::runtime::bytecode::opkind::assign_to_existing_local, this, program.local(m_variable_name, m_variable_key));
+            }
+            else
+            {
+                program.emit(sqf::runtime::bytecode::opkind::assign_to, this, program.variable(m_variable_name, m_variable_key));
+            }
+        }
     };
 }
\ No newline at end of file
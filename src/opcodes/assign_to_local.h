@@ -3,6 +3,7 @@
 #include "../runtime/value.h"
 #include "../runtime/data.h"
 #include "../runtime/runtime.h"
+#include "../runtime/value_scope.h"
 
 namespace sqf::opcodes
 {
@@ -13,35 +14,55 @@ namespace sqf::opcodes
         std::string ___TYPE = "assign_to_local";
 #endif
         std::string m_variable_name;
+        // Lowercased variable name, computed once so lookups do not have to copy and transform it.
+        std::string m_variable_key;
 
     public:
-        assign_to_local(std::string value) : m_variable_name(value) {}
-        assign_to_local(std::string_view value) : m_variable_name(value.begin(), value.end()) {}
-        virtual void execute(sqf::runtime::runtime& vm) const override
+        assign_to_local(std::string value) : m_variable_name(value), m_variable_key(sqf::runtime::value_scope::to_key(value)) {}
+        assign_to_local(std::string_view value) : assign_to_local(std::string(value.begin(), value.end())) {}
+        /// <summary>
+        /// Executes the instruction with the provided operands. Used by execute and by the flat dispatch of lowered programs.
+        /// source is only used for diagnostics.
+        /// Returns the variable assigned to or nullptr if nothing got assigned.
+        /// </summary>
+        static sqf::runtime::value* execute(sqf::runtime::runtime& vm, const sqf::runtime::instruction& source, const std::string& variable_name, const std::string& variable_key)
         {
             auto& context = vm.context_active();
 
             auto value = vm.context_active().pop_value();
-            if (m_variable_name.empty()) { return; }
+            if (variable_name.empty()) { return nullptr; }
             if (!value.has_value())
             {
                 if (context.weak_error_handling())
                 {
-                    vm.__logmsg(logmessage::runtime::FoundNoValueWeak(diag_info()));
+                    vm.__logmsg(logmessage::runtime::FoundNoValueWeak(source.diag_info()));
                 }
                 else
                 {
-                    vm.__logmsg(logmessage::runtime::FoundNoValue(diag_info()));
+                    vm.__logmsg(logmessage::runtime::FoundNoValue(source.diag_info()));
                 }
-                return;
+                return nullptr;
             }
             else if (value->is<sqf::types::t_nothing>())
             {
-                vm.__logmsg(logmessage::runtime::AssigningNilValue(diag_info(), m_variable_name));
+                vm.__logmsg(logmessage::runtime::AssigningNilValue(source.diag_info(), variable_name));
             }
 
-            context.current_frame()[m_variable_name] = *value;
+            auto& variable = context.current_frame().at_key(variable_key);
+            variable = *value;
+            return &variable;
         }
+        /// <summary>
+        /// Same as execute, but binds the local slot of the program running in the current frame to the variable (see bytecode::program::local).
+        /// </summary>
+        static void execute_local(sqf::runtime::runtime& vm, const sqf::runtime::instruction& source, uint32_t slot, const std::string& variable_name, const std::string& variable_key)
+        {
+            if (auto variable = execute(vm, source, variable_name, variable_key))
+            {
+                vm.context_active().current_frame().local_slot(slot, variable, true);
+            }
+        }
+        virtual void execute(sqf::runtime::runtime& vm) const override { execute(vm, *this, m_variable_name, m_variable_key); }
         virtual std::string to_string() const override { return std::string("ASSIGNTOLOCAL ") + m_variable_name; }
         std::string_view variable_name() const { return m_variable_name; }
 
@@ -71,5 +92,10 @@ namespace sqf::opcodes
             auto casted = dynamic_cast<const assign_to_local*>(p_other);
             return casted != nullptr && casted->m_variable_name == m_variable_name;
         }
+
+        virtual void lower(sqf::runtime::bytecode::program& program) const override
+        {
+            program.emit(sqf::runtime::bytecode::opkind::assign_to_local, this, program.local(m_variable_name, m_variable_key));
+        }
     };
 }
\ No newline at end of file
@@ -16,11 +16,17 @@ namespace sqf::opcodes
 #endif
     private:
         std::string m_operator_name;
+        sqf::runtime::sqfop_id m_operator_id;
         short m_precedence;
+        mutable sqf::runtime::sqfop_inline_cache<sqf::runtime::sqfop_binary> m_cache;
 
     public:
-        call_binary(std::string key, short precedence) : m_operator_name(key), m_precedence(precedence) {}
-        virtual void execute(sqf::runtime::runtime& vm) const override
+        call_binary(std::string key, short precedence) : m_operator_name(key), m_operator_id(sqf::runtime::sqfop_symbols::intern(key)), m_precedence(precedence) {}
+        /// <summary>
+        /// Executes the instruction with the provided operands. Used by execute and by the flat dispatch of lowered programs.
+        /// source is only used for diagnostics.
+        /// </summary>
+        static void execute(sqf::runtime::runtime& vm, const sqf::runtime::instruction& source, sqf::runtime::sqfop_id operator_id, const std::string& operator_name, sqf::runtime::sqfop_inline_cache<sqf::runtime::sqfop_binary>& cache)
         {
             auto& context = vm.context_active();
 
@@ -29,17 +35,17 @@ namespace sqf::opcodes
             {
                 if (context.weak_error_handling())
                 {
-                    vm.__logmsg(logmessage::runtime::NoValueFoundForRightArgumentWeak(diag_info()));
+                    vm.__logmsg(logmessage::runtime::NoValueFoundForRightArgumentWeak(source.diag_info()));
                 }
                 else
                 {
-                    vm.__logmsg(logmessage::runtime::NoValueFoundForRightArgument(diag_info()));
+                    vm.__logmsg(logmessage::runtime::NoValueFoundForRightArgument(source.diag_info()));
                 }
                 return;
             }
             else if (right_value->is<sqf::types::t_nothing>())
             {
-                vm.__logmsg(logmessage::runtime::NilValueFoundForRightArgumentWeak(diag_info()));
+                vm.__logmsg(logmessage::runtime::NilValueFoundForRightArgumentWeak(source.diag_info()));
                 return;
             }
 
@@ -50,48 +56,47 @@ namespace sqf::opcodes
             {
                 if (context.weak_error_handling())
                 {
-                    vm.__logmsg(logmessage::runtime::NoValueFoundForRightArgumentWeak(diag_info()));
+                    vm.__logmsg(logmessage::runtime::NoValueFoundForRightArgumentWeak(source.diag_info()));
                 }
                 else
                 {
-                    vm.__logmsg(logmessage::runtime::NoValueFoundForRightArgument(diag_info()));
+                    vm.__logmsg(logmessage::runtime::NoValueFoundForRightArgument(source.diag_info()));
                 }
                 return;
             }
             else if (left_value->is<sqf::types::t_nothing>())
             {
-                vm.__logmsg(logmessage::runtime::NilValueFoundForRightArgumentWeak(diag_info()));
+                vm.__logmsg(logmessage::runtime::NilValueFoundForRightArgumentWeak(source.diag_info()));
                 return;
             }
 
             auto tleft = left_value->type();
             auto tright = right_value->type();
-            sqf::runtime::sqfop_binary::key key = { m_operator_name, tleft, tright };
-
-            if (!vm.sqfop_exists(key))
+            auto generation = vm.sqfop_generation();
+            auto op = cache.find(generation, tleft, tright);
+            if (op)
+            {
+                vm.sqfop_cache_stats().hits++;
+            }
+            else
             {
-                key = { m_operator_name, sqf::types::t_any(), tright };
-                if (!vm.sqfop_exists(key))
+                vm.sqfop_cache_stats().misses++;
+                op = vm.sqfop_resolve(operator_id, tleft, tright);
+                if (!op)
                 {
-                    key = { m_operator_name, tleft, sqf::types::t_any() };
-                    if (!vm.sqfop_exists(key))
-                    {
-                        key = { m_operator_name, sqf::types::t_any(), sqf::types::t_any() };
-                        if (!vm.sqfop_exists(key))
-                        {
-                            vm.__logmsg(logmessage::runtime::UnknownInputTypeCombinationBinary(diag_info(), tleft, key.name, tright));
-                            return;
-                        }
-                    }
+                    vm.__logmsg(logmessage::runtime::UnknownInputTypeCombinationBinary(source.diag_info(), tleft, operator_name, tright));
+                    return;
                 }
+                cache.insert(generation, tleft, tright, op);
             }
-            auto op = vm.sqfop_at(key);
-            auto return_value = op.execute(vm, *left_value, *right_value);
+            auto return_value = op->execute(vm, *left_value, *right_value);
 
             context.push_value(return_value);
         }
+        virtual void execute(sqf::runtime::runtime& vm) const override { execute(vm, *this, m_operator_id, m_operator_name, m_cache); }
         virtual std::string to_string() const override { return std::string("CALLBINARY ") + m_operator_name; }
         std::string_view operator_name() const { return m_operator_name; }
+        sqf::runtime::sqfop_id operator_id() const { return m_operator_id; }
         short precedence() const { return m_precedence; }
 
 
@@ -132,5 +137,10 @@ namespace sqf::opcodes
             auto casted = dynamic_cast<const call_binary*>(p_other);
             return casted != nullptr && casted->m_operator_name == m_operator_name;
         }
+
+        virtual void lower(sqf::runtime::bytecode::program& program) const override
+        {
+            program.emit(sqf::runtime::bytecode::opkind::call_binary, this, program.binary(m_operator_id, m_operator_name));
+        }
     };
 }
\ No newline at end of file
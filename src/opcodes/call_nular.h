@@ -20,25 +20,43 @@ namespace sqf::opcodes
 #endif
     private:
         std::string m_operator_name;
+        sqf::runtime::sqfop_id m_operator_id;
+        mutable sqf::runtime::sqfop_inline_cache<sqf::runtime::sqfop_nular, 1> m_cache;
 
     public:
-        call_nular(std::string key) : m_operator_name(key) {}
-        virtual void execute(sqf::runtime::runtime& vm) const override
+        call_nular(std::string key) : m_operator_name(key), m_operator_id(sqf::runtime::sqfop_symbols::intern(key)) {}
+        /// <summary>
+        /// Executes the instruction with the provided operands. Used by execute and by the flat dispatch of lowered programs.
+        /// source is only used for diagnostics.
+        /// </summary>
+        static void execute(sqf::runtime::runtime& vm, const sqf::runtime::instruction& source, sqf::runtime::sqfop_id operator_id, const std::string& operator_name, sqf::runtime::sqfop_inline_cache<sqf::runtime::sqfop_nular, 1>& cache)
         {
             auto& context = vm.context_active();
-            sqf::runtime::sqfop_nular::key key = { m_operator_name };
-            if (!vm.sqfop_exists(key))
+            auto generation = vm.sqfop_generation();
+            auto op = cache.find(generation, sqf::types::t_nothing(), sqf::types::t_nothing());
+            if (op)
             {
-                vm.__logmsg(logmessage::runtime::UnknownInputTypeCombinationNular(diag_info(), key.name));
-                return;
+                vm.sqfop_cache_stats().hits++;
             }
-            auto op = vm.sqfop_at(key);
-            auto return_value = op.execute(vm);
+            else
+            {
+                vm.sqfop_cache_stats().misses++;
+                op = vm.sqfop_resolve(operator_id);
+                if (!op)
+                {
+                    vm.__logmsg(logmessage::runtime::UnknownInputTypeCombinationNular(source.diag_info(), operator_name));
+                    return;
+                }
+                cache.insert(generation, sqf::types::t_nothing(), sqf::types::t_nothing(), op);
+            }
+            auto return_value = op->execute(vm);
 
             context.push_value(return_value);
         }
+        virtual void execute(sqf::runtime::runtime& vm) const override { execute(vm, *this, m_operator_id, m_operator_name, m_cache); }
         virtual std::string to_string() const override { return std::string("CALLNULAR ") + m_operator_name; }
         std::string_view operator_name() const { return m_operator_name; }
+        sqf::runtime::sqfop_id operator_id() const { return m_operator_id; }
         virtual std::optional<std::string> reconstruct(
             std::vector<sqf::runtime::instruction::sptr>::const_reverse_iterator& current,
             std::vector<sqf::runtime::instruction::sptr>::const_reverse_iterator end,
@@ -52,5 +70,10 @@ namespace sqf::opcodes
             auto casted = dynamic_cast<const call_nular*>(p_other);
             return casted != nullptr && casted->m_operator_name == m_operator_name;
         }
+
+        virtual void lower(sqf::runtime::bytecode::program& program) const override
+        {
+            program.emit(sqf::runtime::bytecode::opkind::call_nular, this, program.nular(m_operator_id, m_operator_name));
+        }
     };
 }
\ No newline at end of file
@@ -15,10 +15,16 @@ namespace sqf::opcodes
 #endif
     private:
         std::string m_operator_name;
+        sqf::runtime::sqfop_id m_operator_id;
+        mutable sqf::runtime::sqfop_inline_cache<sqf::runtime::sqfop_unary, 2> m_cache;
 
     public:
-        call_unary(std::string key) : m_operator_name(key) {}
-        virtual void execute(sqf::runtime::runtime& vm) const override
+        call_unary(std::string key) : m_operator_name(key), m_operator_id(sqf::runtime::sqfop_symbols::intern(key)) {}
+        /// <summary>
+        /// Executes the instruction with the provided operands. Used by execute and by the flat dispatch of lowered programs.
+        /// source is only used for diagnostics.
+        /// </summary>
+        static void execute(sqf::runtime::runtime& vm, const sqf::runtime::instruction& source, sqf::runtime::sqfop_id operator_id, const std::string& operator_name, sqf::runtime::sqfop_inline_cache<sqf::runtime::sqfop_unary, 2>& cache)
         {
             auto& context = vm.context_active();
 
@@ -27,38 +33,46 @@ namespace sqf::opcodes
             {
                 if (context.weak_error_handling())
                 {
-                    vm.__logmsg(logmessage::runtime::NoValueFoundForRightArgumentWeak(diag_info()));
+                    vm.__logmsg(logmessage::runtime::NoValueFoundForRightArgumentWeak(source.diag_info()));
                 }
                 else
                 {
-                    vm.__logmsg(logmessage::runtime::NoValueFoundForRightArgument(diag_info()));
+                    vm.__logmsg(logmessage::runtime::NoValueFoundForRightArgument(source.diag_info()));
                 }
                 return;
             }
             else if (right_value->is<sqf::types::t_nothing>())
             {
-                vm.__logmsg(logmessage::runtime::NilValueFoundForRightArgumentWeak(diag_info()));
+                vm.__logmsg(logmessage::runtime::NilValueFoundForRightArgumentWeak(source.diag_info()));
                 return;
             }
             
             auto tright = right_value->operator sqf::runtime::type();
-            sqf::runtime::sqfop_unary::key key = { m_operator_name, tright };
-            if (!vm.sqfop_exists(key))
+            auto generation = vm.sqfop_generation();
+            auto op = cache.find(generation, sqf::types::t_nothing(), tright);
+            if (op)
             {
-                key = { m_operator_name, sqf::types::t_any() };
-                if (!vm.sqfop_exists(key))
+                vm.sqfop_cache_stats().hits++;
+            }
+            else
+            {
+                vm.sqfop_cache_stats().misses++;
+                op = vm.sqfop_resolve(operator_id, tright);
+                if (!op)
                 {
-                    vm.__logmsg(logmessage::runtime::UnknownInputTypeCombinationUnary(diag_info(), key.name, tright));
+                    vm.__logmsg(logmessage::runtime::UnknownInputTypeCombinationUnary(source.diag_info(), operator_name, tright));
                     return;
                 }
+                cache.insert(generation, sqf::types::t_nothing(), tright, op);
             }
-            auto op = vm.sqfop_at(key);
-            auto return_value = op.execute(vm, *right_value);
+            auto return_value = op->execute(vm, *right_value);
 
             context.push_value(return_value);
         }
+        virtual void execute(sqf::runtime::runtime& vm) const override { execute(vm, *this, m_operator_id, m_operator_name, m_cache); }
         virtual std::string to_string() const override { return std::string("CALLUNARY ") + m_operator_name; }
         std::string_view operator_name() const { return m_operator_name; }
+        sqf::runtime::sqfop_id operator_id() const { return m_operator_id; }
         virtual std::optional<std::string> reconstruct(
             std::vector<sqf::runtime::instruction::sptr>::const_reverse_iterator& current,
             std::vector<sqf::runtime::instruction::sptr>::const_reverse_iterator end,
@@ -81,5 +95,10 @@ namespace sqf::opcodes
             auto casted = dynamic_cast<const call_unary*>(p_other);
             return casted != nullptr && casted->m_operator_name == m_operator_name;
         }
+
+        virtual void lower(sqf::runtime::bytecode::program& program) const override
+        {
+            program.emit(sqf::runtime::bytecode::opkind::call_unary, this, program.unary(m_operator_id, m_operator_name));
+        }
     };
 }
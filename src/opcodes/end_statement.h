@@ -25,5 +25,10 @@ namespace sqf::opcodes
             auto casted = dynamic_cast<const end_statement*>(p_other);
             return casted != nullptr;
         }
+
+        virtual void lower(sqf::runtime::bytecode::program& program) const override
+        {
+            program.emit(sqf::runtime::bytecode::opkind::end_statement, this);
+        }
     };
 }
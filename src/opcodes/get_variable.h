@@ -19,38 +19,60 @@ namespace sqf::opcodes
         std::string ___TYPE = "get_variable";
 #endif
         std::string m_variable_name;
+        // Lowercased variable name, computed once so lookups do not have to copy and transform it.
+        std::string m_variable_key;
     public:
-        get_variable(std::string variable_name) : m_variable_name(variable_name) {}
-        get_variable(std::string_view value) : m_variable_name(value.begin(), value.end()) {}
-        virtual void execute(sqf::runtime::runtime& vm) const override
+        get_variable(std::string variable_name) : m_variable_name(variable_name), m_variable_key(sqf::runtime::value_scope::to_key(variable_name)) {}
+        get_variable(std::string_view value) : get_variable(std::string(value.begin(), value.end())) {}
+        /// <summary>
+        /// Executes the instruction with the provided operands. Used by execute and by the flat dispatch of lowered programs.
+        /// source is only used for diagnostics.
+        /// </summary>
+        static void execute(sqf::runtime::runtime& vm, const sqf::runtime::instruction& source, const std::string& variable_name, const std::string& variable_key)
         {
-            if (m_variable_name[0] == '_')
+            if (variable_name[0] == '_')
             { // local variable
-                auto opt = vm.context_active().get_variable(m_variable_name);
-                if (opt.has_value())
+                auto res = vm.context_active().find_variable_key(variable_key);
+                if (res)
                 {
-                    vm.context_active().push_value(*opt);
+                    vm.context_active().push_value(*res);
                 }
                 else
                 {
-                    vm.__logmsg(logmessage::runtime::VariableNotFound(diag_info(), m_variable_name));
+                    vm.__logmsg(logmessage::runtime::VariableNotFound(source.diag_info(), variable_name));
                     vm.context_active().push_value({});
                 }
             }
             else
             { // global variable
-                auto global_scope = vm.context_active().current_frame().globals_value_scope();
-                if (global_scope->contains(m_variable_name))
+                auto& global_scope = *vm.context_active().current_frame().globals_value_scope();
+                if (auto res = global_scope.find_key(variable_key))
                 {
-                    vm.context_active().push_value(global_scope->at(m_variable_name));
+                    vm.context_active().push_value(*res);
                 }
                 else
                 {
-                    vm.__logmsg(logmessage::runtime::VariableNotFound(diag_info(), m_variable_name));
+                    vm.__logmsg(logmessage::runtime::VariableNotFound(source.diag_info(), variable_name));
                     vm.context_active().push_value({});
                 }
             }
         }
+        /// <summary>
+        /// Same as execute, but for a local variable lowered to a slot of the program running in the current frame (see bytecode::program::local).
+        /// </summary>
+        static void execute_local(sqf::runtime::runtime& vm, const sqf::runtime::instruction& source, uint32_t slot, const std::string& variable_name, const std::string& variable_key)
+        {
+            if (auto res = vm.context_active().find_local_slot(slot, variable_key))
+            {
+                vm.context_active().push_value(*res);
+            }
+            else
+            {
+                vm.__logmsg(logmessage::runtime::VariableNotFound(source.diag_info(), variable_name));
+                vm.context_active().push_value({});
+            }
+        }
+        virtual void execute(sqf::runtime::runtime& vm) const override { execute(vm, *this, m_variable_name, m_variable_key); }
         std::string to_string() const override { return "GETVARIABLE " + m_variable_name; }
         std::string variable_name() const { return m_variable_name; }
 
@@ -67,5 +89,17 @@ namespace sqf::opcodes
             auto casted = dynamic_cast<const get_variable*>(p_other);
             return casted != nullptr && casted->m_variable_name == m_variable_name;
         }
+
+        virtual void lower(sqf::runtime::bytecode::program& program) const override
+        {
+            if (!m_variable_name.empty() && m_variable_name[0] == '_')
+            {
+                program.emit(sqf::runtime::bytecode::opkind::get_local, this, program.local(m_variable_name, m_variable_key));
+            }
+            else
+            {
+                program.emit(sqf::runtime::bytecode::opkind::get_variable, this, program.variable(m_variable_name, m_variable_key));
+            }
+        }
     };
 }
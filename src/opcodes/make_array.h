@@ -24,15 +24,19 @@ namespace sqf::opcodes
 
     public:
         make_array(size_t array_size) : m_array_size(array_size) {}
-        virtual void execute(sqf::runtime::runtime& vm) const override
+        /// <summary>
+        /// Executes the instruction with the provided operands. Used by execute and by the flat dispatch of lowered programs.
+        /// source is only used for diagnostics.
+        /// </summary>
+        static void execute(sqf::runtime::runtime& vm, const sqf::runtime::instruction& source, size_t array_size)
         {
-            auto vec = std::vector<sqf::runtime::value>(m_array_size);
-            for (size_t i = m_array_size - 1; i != (size_t)~0; i--)
+            auto vec = std::vector<sqf::runtime::value>(array_size);
+            for (size_t i = array_size - 1; i != (size_t)~0; i--)
             {
                 auto opt = vm.context_active().pop_value();
                 if (!opt.has_value())
                 {
-                    vm.__logmsg(logmessage::runtime::StackCorruptionMissingValues(diag_info(), m_array_size, i));
+                    vm.__logmsg(logmessage::runtime::StackCorruptionMissingValues(source.diag_info(), array_size, i));
                     break;
                 }
                 else
@@ -42,6 +46,7 @@ namespace sqf::opcodes
             }
             vm.context_active().push_value(std::make_shared<sqf::types::d_array>(vec));
         }
+        virtual void execute(sqf::runtime::runtime& vm) const override { execute(vm, *this, m_array_size); }
         virtual std::string to_string() const override { return std::string("MAKEARRAY ") + std::to_string(m_array_size); }
         size_t array_size() const { return m_array_size; }
 
@@ -83,5 +88,10 @@ namespace sqf::opcodes
             auto casted = dynamic_cast<const make_array*>(p_other);
             return casted != nullptr && casted->m_array_size == m_array_size;
         }
+
+        virtual void lower(sqf::runtime::bytecode::program& program) const override
+        {
+            program.emit(sqf::runtime::bytecode::opkind::make_array, this, (uint32_t)m_array_size);
+        }
     };
 }
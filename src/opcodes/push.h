@@ -39,5 +39,10 @@ namespace sqf::opcodes
             auto casted = dynamic_cast<const push*>(p_other);
             return casted != nullptr && casted->m_value == m_value;
         }
+
+        virtual void lower(sqf::runtime::bytecode::program& program) const override
+        {
+            program.emit(sqf::runtime::bytecode::opkind::push, this, program.constant(m_value));
+        }
     };
 }
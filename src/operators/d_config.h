@@ -25,7 +25,7 @@ namespace sqf
         private:
             sqf::runtime::config m_value;
         protected:
-            bool do_equals(std::shared_ptr<data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<data>& other, bool invariant) const override
             {
                 auto other_config = std::static_pointer_cast<d_config>(other)->m_value;
                 return other_config == m_value;
@@ -24,7 +24,7 @@ namespace sqf
         private:
             std::weak_ptr<group> m_value;
         protected:
-            bool do_equals(std::shared_ptr<sqf::runtime::data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<sqf::runtime::data>& other, bool invariant) const override
             {
                 return value().get() == std::static_pointer_cast<d_group>(other)->value().get();
             }
@@ -55,7 +55,7 @@ namespace sqf
             std::string to_string() const override { return to_string_sqf(); }
 
             sqf::runtime::type type() const override { return data_type(); }
-            virtual std::size_t hash() const override { return 0; }
+            virtual std::size_t hash() const override { return std::hash<const void*>()(value().get()); }
 
             bool is_null() const { return m_value.expired(); }
 
@@ -62,7 +62,7 @@ namespace sqf
         private:
             side m_value;
         protected:
-            bool do_equals(std::shared_ptr<sqf::runtime::data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<sqf::runtime::data>& other, bool invariant) const override
             {
                 return m_value == std::static_pointer_cast<d_side>(other)->m_value;
             }
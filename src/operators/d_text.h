@@ -23,9 +23,9 @@ namespace sqf
         private:
             std::string m_value;
         protected:
-            bool do_equals(std::shared_ptr<data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<data>& other, bool invariant) const override
             {
-                auto other_text = std::static_pointer_cast<d_text>(other)->m_value;
+                const auto& other_text = std::static_pointer_cast<d_text>(other)->m_value;
                 return other_text == m_value;
             }
         public:
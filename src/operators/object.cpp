@@ -5,6 +5,185 @@
 #include "../runtime/d_array.h"
 #include "../runtime/d_scalar.h"
 
+#include <cmath>
+#include <limits>
+#include <iterator>
+
+#pragma region ::sqf::types::object::object_storage
+
+namespace
+{
+    // Number of grid cells the square enclosing the given radius spans at most.
+    double grid_cells(float radius)
+    {
+        double span = std::ceil(static_cast<double>(radius) / sqf::types::object::object_storage::grid_cell_size);
+        return (2 * span + 1) * (2 * span + 1);
+    }
+}
+
+int32_t sqf::types::object::object_storage::grid_coord(float f)
+{
+    // Clamp (mapping NaN to zero) as converting out-of-range floats to integers is undefined.
+    double cell = std::floor(static_cast<double>(f) / grid_cell_size);
+    if (std::isnan(cell)) { return 0; }
+    if (cell < std::numeric_limits<int32_t>::min()) { return std::numeric_limits<int32_t>::min(); }
+    if (cell > std::numeric_limits<int32_t>::max()) { return std::numeric_limits<int32_t>::max(); }
+    return static_cast<int32_t>(cell);
+}
+
+void sqf::types::object::object_storage::grid_erase(object* obj, ::sqf::runtime::vec3 pos)
+{
+    auto it = m_grid.find(grid_key(pos));
+    if (it == m_grid.end())
+    {
+        return;
+    }
+    auto& cell = it->second;
+    auto res = std::find(cell.begin(), cell.end(), obj);
+    if (res != cell.end())
+    {
+        *res = cell.back();
+        cell.pop_back();
+    }
+    if (cell.empty())
+    {
+        m_grid.erase(it);
+    }
+}
+
+sqf::types::object::object_storage::~object_storage()
+{
+    for (auto& obj : m_inner)
+    {
+        obj->m_storage = nullptr;
+    }
+}
+
+void sqf::types::object::object_storage::erase_at(std::vector<std::shared_ptr<object>>& vec, size_t object::* slot, size_t index)
+{
+    if (index + 1 != vec.size())
+    {
+        vec[index] = std::move(vec.back());
+        (*vec[index]).*slot = index;
+    }
+    vec.pop_back();
+}
+
+size_t sqf::types::object::object_storage::push_back(std::shared_ptr<object> obj)
+{
+    obj->m_storage = this;
+    grid_insert(obj.get(), obj->m_position);
+    auto& kind = obj->m_is_vehicle ? m_vehicles : m_units;
+    obj->m_kind_slot = kind.size();
+    kind.push_back(obj);
+    obj->m_storage_slot = m_inner.size();
+    m_inner.push_back(std::move(obj));
+    return ++m_id;
+}
+
+void sqf::types::object::object_storage::erase(std::shared_ptr<object> obj)
+{
+    if (!obj || obj->m_storage != this)
+    {
+        return;
+    }
+    grid_erase(obj.get(), obj->m_position);
+    obj->m_storage = nullptr;
+    erase_at(obj->m_is_vehicle ? m_vehicles : m_units, &object::m_kind_slot, obj->m_kind_slot);
+    erase_at(m_inner, &object::m_storage_slot, obj->m_storage_slot);
+}
+
+void sqf::types::object::object_storage::moved(object* obj, ::sqf::runtime::vec3 from, ::sqf::runtime::vec3 to)
+{
+    if (grid_key(from) == grid_key(to))
+    {
+        return;
+    }
+    grid_erase(obj, from);
+    grid_insert(obj, to);
+}
+
+void sqf::types::object::object_storage::query(::sqf::runtime::vec3 center, float radius, bool is2d, const std::function<void(const std::shared_ptr<object>&)>& func)
+{
+    if (!(radius >= 0))
+    {
+        return;
+    }
+    auto in_range = [&](const object* obj) { return (is2d ? obj->distance2d(center) : obj->distance3d(center)) <= radius; };
+
+    if (grid_cells(radius) > static_cast<double>(m_inner.size()))
+    {
+        for (auto& obj : m_inner)
+        {
+            if (in_range(obj.get()))
+            {
+                func(obj);
+            }
+        }
+        return;
+    }
+
+    // The height is not part of the grid. As the 3D distance is never smaller than the 2D distance,
+    // the cells covering the 2D radius contain all candidates for both.
+    int64_t min_x = grid_coord(center.x - radius);
+    int64_t max_x = grid_coord(center.x + radius);
+    int64_t min_y = grid_coord(center.y - radius);
+    int64_t max_y = grid_coord(center.y + radius);
+    for (auto x = min_x; x <= max_x; x++)
+    {
+        for (auto y = min_y; y <= max_y; y++)
+        {
+            auto it = m_grid.find(grid_key(static_cast<int32_t>(x), static_cast<int32_t>(y)));
+            if (it == m_grid.end())
+            {
+                continue;
+            }
+            for (auto obj : it->second)
+            {
+                if (in_range(obj))
+                {
+                    func(obj->shared_from_this());
+                }
+            }
+        }
+    }
+}
+
+std::vector<std::shared_ptr<sqf::types::object>> sqf::types::object::object_storage::nearest(::sqf::runtime::vec3 center, size_t count, float max_radius, bool is2d, const std::function<bool(const std::shared_ptr<object>&)>& filter)
+{
+    std::vector<std::pair<float, std::shared_ptr<object>>> found;
+    if (count == 0)
+    {
+        return {};
+    }
+    for (float radius = grid_cell_size; ; radius *= 2)
+    {
+        // Once the radius covers more cells than there are objects, query checks all objects anyway.
+        bool exhaustive = radius >= max_radius || grid_cells(radius) > static_cast<double>(m_inner.size());
+        found.clear();
+        query(center, exhaustive ? max_radius : radius, is2d, [&](const std::shared_ptr<object>& obj) {
+            if (filter(obj))
+            {
+                found.emplace_back(is2d ? obj->distance2d(center) : obj->distance3d(center), obj);
+            }
+        });
+        // Every object outside of the radius is further away than the ones found,
+        // hence the closest ones are known as soon as enough have been found.
+        if (exhaustive || found.size() >= count)
+        {
+            break;
+        }
+    }
+    auto last = found.begin() + static_cast<std::ptrdiff_t>(std::min(count, found.size()));
+    std::partial_sort(found.begin(), last, found.end(), [](const auto& l, const auto& r) { return l.first < r.first; });
+    std::vector<std::shared_ptr<object>> result;
+    result.reserve(static_cast<size_t>(last - found.begin()));
+    std::transform(found.begin(), last, std::back_inserter(result), [](const auto& pair) { return pair.second; });
+    return result;
+}
+
+#pragma endregion
+
 #pragma region ::sqf::types::object::soldiers
 
 bool sqf::types::object::soldiers_::push_back(sqf::runtime::value val)
@@ -60,6 +239,9 @@ void sqf::types::object::soldiers_::erase(std::shared_ptr<d_object> obj)
 
 sqf::types::object::object(sqf::runtime::config config, bool is_vehicle) :
     m_netid(~(size_t)0),
+    m_storage(nullptr),
+    m_storage_slot(0),
+    m_kind_slot(0),
     m_config(config),
     m_is_vehicle(is_vehicle),
     m_varname(""),
@@ -76,6 +258,16 @@ sqf::types::object::object(sqf::runtime::config config, bool is_vehicle) :
 {
 }
 
+void sqf::types::object::position(::sqf::runtime::vec3 vec)
+{
+    auto previous = m_position;
+    m_position = vec;
+    if (m_storage)
+    {
+        m_storage->moved(this, previous, vec);
+    }
+}
+
 void sqf::types::object::driver(std::shared_ptr<d_object> val)
 {
     if (m_configuration.has_driver && (val->is_null() || !val->value()->is_vehicle()))
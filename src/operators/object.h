@@ -11,6 +11,9 @@
 #include <array>
 #include <vector>
 #include <algorithm>
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
 
 namespace sqf
 {
@@ -25,21 +28,69 @@ namespace sqf
         class object : public std::enable_shared_from_this<::sqf::types::object>, public ::sqf::runtime::value_scope
         {
         public:
+            /// <summary>
+            /// Owns all living objects.
+            /// Objects know their slot in the storage (and in the unit or vehicle index),
+            /// making create and delete O(1).
+            /// Additionally keeps the objects in a uniform 2D grid (updated on every position change)
+            /// so that positional queries only have to look at objects in nearby cells.
+            /// </summary>
             class object_storage : public sqf::runtime::runtime::datastorage
             {
+            public:
+                // Edge length in meters of a single grid cell.
+                static constexpr float grid_cell_size = 64.0f;
             private:
                 std::vector<std::shared_ptr<object>> m_inner;
+                std::vector<std::shared_ptr<object>> m_units;
+                std::vector<std::shared_ptr<object>> m_vehicles;
                 size_t m_id;
                 std::shared_ptr<object> m_player;
+                std::unordered_map<uint64_t, std::vector<object*>> m_grid;
+
+                // Removes vec[index] by moving the last element into its slot (updating the slot stored in the moved object).
+                static void erase_at(std::vector<std::shared_ptr<object>>& vec, size_t object::* slot, size_t index);
+
+                static int32_t grid_coord(float f);
+                static uint64_t grid_key(int32_t x, int32_t y) { return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y); }
+                static uint64_t grid_key(::sqf::runtime::vec3 pos) { return grid_key(grid_coord(pos.x), grid_coord(pos.y)); }
+                void grid_insert(object* obj, ::sqf::runtime::vec3 pos) { m_grid[grid_key(pos)].push_back(obj); }
+                void grid_erase(object* obj, ::sqf::runtime::vec3 pos);
             public:
-                object_storage() : m_inner(), m_id(0) {}
-                virtual ~object_storage() override {}
-                size_t push_back(std::shared_ptr<object> obj) { m_inner.push_back(obj); return ++m_id; }
-                void erase(std::shared_ptr<object> obj) { auto it = std::find(m_inner.begin(), m_inner.end(), obj); if (it != m_inner.end()) { *it = m_inner.back(); m_inner.pop_back(); } }
+                object_storage() : m_inner(), m_units(), m_vehicles(), m_id(0), m_player(), m_grid() {}
+                virtual ~object_storage() override;
+                size_t push_back(std::shared_ptr<object> obj);
+                void erase(std::shared_ptr<object> obj);
                 std::vector<std::shared_ptr<object>>::iterator begin() { return m_inner.begin(); }
                 std::vector<std::shared_ptr<object>>::iterator end() { return m_inner.end(); }
+                size_t size() const { return m_inner.size(); }
+                // All objects which are not vehicles.
+                const std::vector<std::shared_ptr<object>>& units() const { return m_units; }
+                // All objects which are vehicles.
+                const std::vector<std::shared_ptr<object>>& vehicles() const { return m_vehicles; }
                 std::shared_ptr<object> player() { return m_player; }
                 void player(std::shared_ptr<object> obj) { m_player = obj; }
+
+                /// <summary>
+                /// Moves the object to the grid cell of its new position. Called by object::position.
+                /// </summary>
+                void moved(object* obj, ::sqf::runtime::vec3 from, ::sqf::runtime::vec3 to);
+
+                /// <summary>
+                /// Calls func for every object within radius of center.
+                /// Only objects in grid cells overlapping the radius are checked (unless the radius covers
+                /// more cells than there are objects, in which case all objects are checked).
+                /// </summary>
+                /// <param name="is2d">If true, the height (z) is ignored.</param>
+                void query(::sqf::runtime::vec3 center, float radius, bool is2d, const std::function<void(const std::shared_ptr<object>&)>& func);
+
+                /// <summary>
+                /// Returns up to count objects matching the filter, closest first.
+                /// The search radius starts at a single grid cell and doubles until enough objects are found,
+                /// max_radius is reached or the radius covers all objects.
+                /// </summary>
+                /// <param name="is2d">If true, the height (z) is ignored.</param>
+                std::vector<std::shared_ptr<object>> nearest(::sqf::runtime::vec3 center, size_t count, float max_radius, bool is2d, const std::function<bool(const std::shared_ptr<object>&)>& filter);
             };
             struct configuration_
             {
@@ -89,6 +140,11 @@ namespace sqf
             };
         private:
             size_t m_netid;
+            object_storage* m_storage;
+            // Slot in object_storage::m_inner
+            size_t m_storage_slot;
+            // Slot in object_storage::m_units or object_storage::m_vehicles
+            size_t m_kind_slot;
             sqf::runtime::config m_config;
             bool m_is_vehicle;
 
@@ -115,7 +171,7 @@ namespace sqf
             bool alive() const { return m_damage < 1; }
 
             ::sqf::runtime::vec3 position() const { return m_position; }
-            void position(::sqf::runtime::vec3 vec) { m_position = vec; }
+            void position(::sqf::runtime::vec3 vec);
 
             ::sqf::runtime::vec3 velocity() const { return m_velocity; }
             void velocity(::sqf::runtime::vec3 vec) { m_velocity = vec; }
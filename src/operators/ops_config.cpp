@@ -40,10 +40,10 @@ namespace
         {
             // Get navigation path
             std::vector<std::string> path;
-            path.push_back(nav->name);
+            path.push_back(std::string(nav->name));
             while (nav->id_parent_logical != config::invalid_id)
             {
-                path.push_back(nav->name);
+                path.push_back(std::string(nav->name));
                 nav = nav.parent_logical();
             }
 
@@ -116,10 +116,10 @@ namespace
         }
         // Get navigation path
         std::vector<value> path;
-        path.push_back(nav->name);
+        path.push_back(std::string(nav->name));
         while (nav->id_parent_logical != config::invalid_id)
         {
-            path.push_back(nav->name);
+            path.push_back(std::string(nav->name));
             nav = nav.parent_logical();
         }
 
@@ -223,7 +223,9 @@ namespace
         auto data = nav->value.data_try<d_array>();
         if (data)
         {
-            return data;
+            // Hand out a copy so scripts modifying the result do not alter the config.
+            // Flat arrays share the config storage until modified, so this is cheap.
+            return data->copy_deep();
         }
         else
         {
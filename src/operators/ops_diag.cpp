@@ -22,7 +22,7 @@ namespace
     }
     value diag_tickTime_(runtime& runtime)
     {
-        auto curtime = std::chrono::system_clock::now().time_since_epoch();
+        auto curtime = runtime.now().time_since_epoch();
         auto starttime = runtime.runtime_timestamp().time_since_epoch();
         // Time is since beginning of game so long is fine.
         long long r = static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(curtime - starttime).count());
@@ -189,7 +189,6 @@ void sqf::operators::ops_dummy_nular(sqf::runtime::runtime& runtime)
 	runtime.register_sqfop(nular("savingenabled", "", [](sqf::runtime::runtime& runtime) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "savingenabled")); return {}; }));
 	runtime.register_sqfop(nular("particlesquality", "", [](sqf::runtime::runtime& runtime) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "particlesquality")); return {}; }));
 	runtime.register_sqfop(nular("mapanimcommit", "", [](sqf::runtime::runtime& runtime) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "mapanimcommit")); return {}; }));
-	runtime.register_sqfop(nular("vehicles", "", [](sqf::runtime::runtime& runtime) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "vehicles")); return {}; }));
 	runtime.register_sqfop(nular("curatorselected", "", [](sqf::runtime::runtime& runtime) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "curatorselected")); return {}; }));
 	runtime.register_sqfop(nular("musicvolume", "", [](sqf::runtime::runtime& runtime) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "musicvolume")); return {}; }));
 	runtime.register_sqfop(nular("waves", "", [](sqf::runtime::runtime& runtime) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "waves")); return {}; }));
@@ -455,7 +455,6 @@ void sqf::operators::ops_dummy_unary(sqf::runtime::runtime& runtime)
 	runtime.register_sqfop(unary("currenttask", t_any(), "", [](sqf::runtime::runtime& runtime, value::cref r) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "currenttask")); return {}; })); /* OBJECT */
 	runtime.register_sqfop(unary("flagside", t_any(), "", [](sqf::runtime::runtime& runtime, value::cref r) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "flagside")); return {}; })); /* OBJECT */
 	runtime.register_sqfop(unary("isinremainscollector", t_any(), "", [](sqf::runtime::runtime& runtime, value::cref r) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "isinremainscollector")); return {}; })); /* OBJECT */
-	runtime.register_sqfop(unary("nearestobject", t_any(), "", [](sqf::runtime::runtime& runtime, value::cref r) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "nearestobject")); return {}; })); /* ARRAY */
 	runtime.register_sqfop(unary("magazinesammocargo", t_any(), "", [](sqf::runtime::runtime& runtime, value::cref r) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "magazinesammocargo")); return {}; })); /* OBJECT */
 	runtime.register_sqfop(unary("setplayable", t_any(), "", [](sqf::runtime::runtime& runtime, value::cref r) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "setplayable")); return {}; })); /* OBJECT */
 	runtime.register_sqfop(unary("unlockachievement", t_any(), "", [](sqf::runtime::runtime& runtime, value::cref r) -> value { runtime.__logmsg(logmessage::runtime::ErrorMessage(runtime.context_active().current_frame().diag_info_from_position(), "NOT IMPLEMENTED", "unlockachievement")); return {}; })); /* STRING */
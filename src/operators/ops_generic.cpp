@@ -19,6 +19,7 @@
 
 
 #include <cmath>
+#include <unordered_set>
 
 
 
@@ -96,12 +97,12 @@ namespace
         class behavior_count_exit : public frame::behavior
         {
         private:
-            std::shared_ptr<d_array> m_array;
+            std::shared_ptr<const d_array> m_array;
             size_t m_index;
             size_t m_size;
             int m_count;
         public:
-            behavior_count_exit(std::shared_ptr<d_array> arr) : m_array(arr), m_index(0), m_size(arr->size()), m_count(0) {}
+            behavior_count_exit(std::shared_ptr<const d_array> arr) : m_array(arr), m_index(0), m_size(arr->size()), m_count(0) {}
             virtual result enact(sqf::runtime::runtime& runtime, sqf::runtime::frame& frame) override
             {
                 auto res = runtime.context_active().pop_value();
@@ -138,7 +139,7 @@ namespace
                 {
                     runtime.context_active().clear_values();
                     frame.clear_value_scope();
-                    frame["_x"] = m_array->at(m_index);
+                    frame.at_key("_x") = m_array->at(m_index);
                     return result::seek_start;
                 }
             };
@@ -288,7 +289,10 @@ namespace
                     auto value = res->data_try<d_boolean, bool>();
                     if (value.has_value())
                     {
-                        return result::ok;
+                        if (value.value())
+                        {
+                            return result::ok;
+                        }
                     }
                     else
                     {
@@ -305,7 +309,7 @@ namespace
                     runtime.__logmsg(logmessage::runtime::CallstackFoundNoValue(frame.diag_info_from_position(), "waitUntil"s));
                 }
                 // "Simulate" a frame wait
-                runtime.context_active().suspend(std::chrono::milliseconds(10));
+                runtime.context_active().suspend(runtime.now() + std::chrono::milliseconds(10));
                 runtime.context_active().clear_values();
                 frame.clear_value_scope();
                 return result::seek_start;
@@ -494,11 +498,11 @@ namespace
         class behavior_foreach_exit : public frame::behavior
         {
         private:
-            std::shared_ptr<d_array> m_array;
+            std::shared_ptr<const d_array> m_array;
             size_t m_index;
             size_t m_size;
         public:
-            behavior_foreach_exit(std::shared_ptr<d_array> arr) : m_array(arr), m_index(0), m_size(arr->size()) {}
+            behavior_foreach_exit(std::shared_ptr<const d_array> arr) : m_array(arr), m_index(0), m_size(arr->size()) {}
             virtual result enact(sqf::runtime::runtime& runtime, sqf::runtime::frame& frame) override
             {
                 if (m_size != m_array->size())
@@ -514,8 +518,8 @@ namespace
                 {
                     runtime.context_active().clear_values();
                     frame.clear_value_scope();
-                    frame["_forEachIndex"] = m_index;
-                    frame["_x"] = m_array->at(m_index);
+                    frame.at_key("_foreachindex") = m_index;
+                    frame.at_key("_x") = m_array->at(m_index);
                     return result::seek_start;
                 }
             };
@@ -532,7 +536,8 @@ namespace
     }
     value select_array_scalar(runtime& runtime, value::cref left, value::cref right)
     {
-        auto arr = left.data<d_array>()->value();
+        auto arr_data = left.data<d_array>();
+        const auto& arr = arr_data->view();
         auto index = static_cast<int>(std::round(right.data<d_scalar, float>()));
 
         if (static_cast<int>(arr.size()) < index || index < 0)
@@ -549,7 +554,8 @@ namespace
     }
     value select_array_bool(runtime& runtime, value::cref left, value::cref right)
     {
-        auto arr = left.data<d_array>()->value();
+        auto arr_data = left.data<d_array>();
+        const auto& arr = arr_data->view();
         auto flag = right.data<d_boolean, bool>();
         if (arr.size() != 2)
         {
@@ -570,7 +576,8 @@ namespace
     }
     value select_array_array(runtime& runtime, value::cref left, value::cref right)
     {
-        auto vec = left.data<d_array>()->value();
+        auto vec_data = left.data<d_array>();
+        const auto& vec = vec_data->view();
         auto arr = right.data<d_array>()->value();
         if (arr.size() < 1)
         {
@@ -627,12 +634,12 @@ namespace
         class behavior_select_exit : public frame::behavior
         {
         private:
-            std::shared_ptr<d_array> m_array;
+            std::shared_ptr<const d_array> m_array;
             std::vector<value> m_out;
             size_t m_index;
             size_t m_size;
         public:
-            behavior_select_exit(std::shared_ptr<d_array> arr) : m_array(arr), m_index(0), m_size(arr->size()) {}
+            behavior_select_exit(std::shared_ptr<const d_array> arr) : m_array(arr), m_index(0), m_size(arr->size()) {}
             virtual result enact(sqf::runtime::runtime& runtime, sqf::runtime::frame& frame) override
             {
                 auto res = runtime.context_active().pop_value();
@@ -673,7 +680,7 @@ namespace
                 {
                     runtime.context_active().clear_values();
                     frame.clear_value_scope();
-                    frame["_x"] = m_array->at(m_index);
+                    frame.at_key("_x") = m_array->at(m_index);
                     return result::seek_start;
                 }
             };
@@ -709,58 +716,93 @@ namespace
             return {};
 
         // Confirm array element sub arrays are consistent in structure
+        std::vector<sqf::runtime::type> kinds;
         if (type == t_array())
         {
-            auto subarray = (*arr)[0].data<d_array>()->value();
-            std::vector<sqf::runtime::type> types;
-            std::transform(subarray.begin(), subarray.end(), std::back_inserter(types), [](const auto& elem) { return elem.type(); });
+            auto subarray = (*arr)[0].data<d_array>();
+            std::transform(subarray->begin(), subarray->end(), std::back_inserter(kinds), [](const auto& elem) { return elem.type(); });
             for (const auto& elem : *arr)
             {
-                if (!d_array{ elem.data<d_array>()->value() }.check_type(runtime, types))
+                if (!elem.data<d_array>()->check_type(runtime, kinds))
                     return {};
             }
         }
+        else
+        {
+            kinds.push_back(type);
+        }
 
-        std::sort(arr->begin(), arr->end(), [sort_flag](sqf::runtime::value::cref a, sqf::runtime::value::cref b) -> bool {
-
-            if (a.is<t_array>())
+        // Decorate: extract the sort keys once, so the comparator neither copies
+        // sub-arrays nor strings. Sub-arrays are compared element-wise, positions
+        // not holding STRING or SCALAR are ignored.
+        struct sort_key
+        {
+            float scalar;
+            std::string_view string;
+        };
+        auto extract = [](sqf::runtime::value::cref val) -> sort_key {
+            if (val.is<t_scalar>()) { return { val.data<d_scalar, float>(), {} }; }
+            if (val.is<t_string>()) { return { 0, val.data<d_string>()->view() }; }
+            return { 0, {} };
+        };
+        const size_t count = arr->size();
+        const size_t width = kinds.size();
+        std::vector<sort_key> keys;
+        if (type == t_array())
+        {
+            keys.reserve(count * width);
+            for (auto& elem : *arr)
             {
-                auto a_arr = a.data<d_array>()->value();
-                auto b_arr = b.data<d_array>()->value();
-
-                for (size_t idx = 0; idx < a_arr.size(); ++idx)
+                auto subarray = elem.data<d_array>();
+                for (auto& subelem : *subarray)
                 {
-                    const auto& a_elem = a_arr[idx];
-                    const auto& b_elem = b_arr[idx];
-
-                    if (a.is<t_string>())
-                    {
-                        if (a_elem.data<d_string, std::string>() < b_elem.data<d_string, std::string>()) return sort_flag;
-                        if (a_elem.data<d_string, std::string>() > b_elem.data<d_string, std::string>()) return !sort_flag;
-                    }
-                    else if (a.is<t_scalar>())
-                    {
-                        if (a_elem.data<d_scalar, float>() < b_elem.data<d_scalar, float>()) return sort_flag;
-                        if (a_elem.data<d_scalar, float>() > b_elem.data<d_scalar, float>()) return !sort_flag;
-                    }
+                    keys.push_back(extract(subelem));
                 }
-                return !sort_flag;
             }
-            else if (a.is<t_string>())
+        }
+        else
+        {
+            keys.reserve(count);
+            for (auto& elem : *arr)
             {
-                if (a.data<d_string, std::string>() < b.data<d_string, std::string>()) return sort_flag;
-                if (a.data<d_string, std::string>() > b.data<d_string, std::string>()) return !sort_flag;
-                return false;
+                keys.push_back(extract(elem));
             }
-            else if (a.is<t_scalar>())
+        }
+
+        // Sort the indices by their keys.
+        std::vector<size_t> order(count);
+        for (size_t i = 0; i < count; i++) { order[i] = i; }
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) -> bool {
+            const sort_key* a_keys = keys.data() + a * width;
+            const sort_key* b_keys = keys.data() + b * width;
+            for (size_t idx = 0; idx < width; ++idx)
             {
-                if (a.data<d_scalar, float>() < b.data<d_scalar, float>()) return sort_flag;
-                if (a.data<d_scalar, float>() > b.data<d_scalar, float>()) return !sort_flag;
-                return false;
+                if (kinds[idx] == t_string())
+                {
+                    int cmp = a_keys[idx].string.compare(b_keys[idx].string);
+                    if (cmp != 0) { return sort_flag ? cmp < 0 : cmp > 0; }
+                }
+                else if (kinds[idx] == t_scalar())
+                {
+                    if (a_keys[idx].scalar < b_keys[idx].scalar) { return sort_flag; }
+                    if (a_keys[idx].scalar > b_keys[idx].scalar) { return !sort_flag; }
+                }
             }
-            return !sort_flag;
+            return false;
             });
 
+        // Undecorate: permute the array in place according to the sorted indices.
+        std::vector<sqf::runtime::value> sorted;
+        sorted.reserve(count);
+        for (auto index : order)
+        {
+            sorted.push_back(std::move((*arr)[index]));
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            (*arr)[i] = std::move(sorted[i]);
+        }
+
         return {};
     }
     value resize_array_scalar(runtime& runtime, value::cref left, value::cref right)
@@ -818,8 +860,8 @@ namespace
     {
         auto arr = left.data<d_array>();
         int newindex = static_cast<int>(arr->size());
-        auto found = std::find(arr->begin(), arr->end(), right);
-        if (found == arr->end())
+        auto found = std::find(arr->cbegin(), arr->cend(), right);
+        if (found == arr->cend())
         {
             if (!arr->push_back(value(right)))
             {
@@ -838,11 +880,11 @@ namespace
         class behavior_findif_exit : public frame::behavior
         {
         private:
-            std::shared_ptr<d_array> m_array;
+            std::shared_ptr<const d_array> m_array;
             size_t m_index;
             size_t m_size;
         public:
-            behavior_findif_exit(std::shared_ptr<d_array> arr) : m_array(arr), m_index(0), m_size(arr->size()) {}
+            behavior_findif_exit(std::shared_ptr<const d_array> arr) : m_array(arr), m_index(0), m_size(arr->size()) {}
             virtual result enact(sqf::runtime::runtime& runtime, sqf::runtime::frame& frame) override
             {
                 auto res = runtime.context_active().pop_value();
@@ -880,7 +922,7 @@ namespace
                 {
                     runtime.context_active().clear_values();
                     frame.clear_value_scope();
-                    frame["_x"] = m_array->at(m_index);
+                    frame.at_key("_x") = m_array->at(m_index);
                     return result::seek_start;
                 }
             };
@@ -1080,12 +1122,12 @@ namespace
         class behavior_apply_exit : public frame::behavior
         {
         private:
-            std::shared_ptr<d_array> m_array;
+            std::shared_ptr<const d_array> m_array;
             std::vector<value> m_out;
             size_t m_index;
             size_t m_size;
         public:
-            behavior_apply_exit(std::shared_ptr<d_array> arr) : m_array(arr), m_index(0), m_size(arr->size()) {}
+            behavior_apply_exit(std::shared_ptr<const d_array> arr) : m_array(arr), m_index(0), m_size(arr->size()) {}
             virtual result enact(sqf::runtime::runtime& runtime, sqf::runtime::frame& frame) override
             {
                 auto res = runtime.context_active().pop_value();
@@ -1112,7 +1154,7 @@ namespace
                 {
                     runtime.context_active().clear_values();
                     frame.clear_value_scope();
-                    frame["_x"] = m_array->at(m_index);
+                    frame.at_key("_x") = m_array->at(m_index);
                     return result::seek_start;
                 }
             };
@@ -1200,18 +1242,16 @@ namespace
             return {};
         }
         auto val = params[1];
+        if (!arr->can_contain(val))
+        {
+            runtime.__logmsg(err::ArrayRecursion(runtime.context_active().current_frame().diag_info_from_position()));
+            return {};
+        }
         if (static_cast<int>(arr->size()) <= index)
         {
             arr->resize(index + 1);
         }
-        auto oldval = (*arr)[index];
         (*arr)[index] = val;
-        if (!arr->recursion_test())
-        {
-            (*arr)[index] = oldval;
-            runtime.__logmsg(err::ArrayRecursion(runtime.context_active().current_frame().diag_info_from_position()));
-            return {};
-        }
         return {};
     }
     value plus_array(runtime& runtime, value::cref right)
@@ -1223,19 +1263,32 @@ namespace
     {
         // create a copy of left array
         auto arr = left.data<d_array, std::vector<sqf::runtime::value>>();
-        auto r = right.data<d_array>();
+        std::shared_ptr<const d_array> r = right.data<d_array>();
         arr.insert(arr.end(), r->begin(), r->end());
         return arr;
     }
 
 
+    // Number of comparisons (left size * right size) above which the array set operations
+    // build a hash set instead of scanning linearly. Relies on value::hash being consistent
+    // with value::operator== (the same requirement d_hashmap has).
+    constexpr size_t array_hash_set_threshold = 256;
+
     value minus_array_array(runtime& runtime, value::cref left, value::cref right)
     {
-        // TODO: optimize (e.g. build a hash based set of the right array and check against it)
-        auto l = left.data<d_array>();
-        auto r = right.data<d_array>();
+        std::shared_ptr<const d_array> l = left.data<d_array>();
+        std::shared_ptr<const d_array> r = right.data<d_array>();
         std::vector<value> result;
 
+        if (l->size() * r->size() > array_hash_set_threshold)
+        {
+            std::unordered_set<value> rset(r->begin(), r->end());
+            std::copy_if(l->begin(), l->end(), std::back_inserter(result), [&rset](value::cref current) {
+                return rset.find(current) == rset.end();
+                });
+            return result;
+        }
+
         std::copy_if(l->begin(), l->end(), std::back_inserter(result), [&r](value::cref current) {
 
             auto found = std::find(r->begin(), r->end(), current);
@@ -1248,17 +1301,27 @@ namespace
     value append_array_array(runtime& runtime, value::cref left, value::cref right)
     {
         auto arr = left.data<d_array>();
-        auto r = right.data<d_array>();
+        std::shared_ptr<const d_array> r = right.data<d_array>();
         arr->insert(arr->end(), r->begin(), r->end());
         return {};
     }
     value arrayintersect_array_array(runtime& runtime, value::cref left, value::cref right)
     {
-        // TODO: optimize (e.g. use hash set for checking)
-        auto l = left.data<d_array>();
-        auto r = right.data<d_array>();
+        std::shared_ptr<const d_array> l = left.data<d_array>();
+        std::shared_ptr<const d_array> r = right.data<d_array>();
         std::vector<value> result;
 
+        if (l->size() * r->size() > array_hash_set_threshold)
+        {
+            std::unordered_set<value> rset(r->begin(), r->end());
+            std::unordered_set<value> added;
+            std::copy_if(l->begin(), l->end(), std::back_inserter(result), [&rset, &added](value::cref current) {
+                // Only add if right argument also contains the element and it was not added already (remove duplicates)
+                return rset.find(current) != rset.end() && added.insert(current).second;
+                });
+            return result;
+        }
+
         std::copy_if(l->begin(), l->end(), std::back_inserter(result), [&r, &result](value::cref current) {
 
             auto found = std::find(result.begin(), result.end(), current);
@@ -1266,10 +1329,8 @@ namespace
             // Result already contains the element. Don't add it (remove duplicates)
             if (found != result.end()) return false;
 
-            found = std::find(r->begin(), r->end(), current);
-
             // Only add if right argument also contains the element
-            return found != r->end();
+            return std::find(r->begin(), r->end(), current) != r->end();
             });
 
         return result;
@@ -1294,7 +1355,7 @@ namespace
     }
     value find_array_any(runtime& runtime, value::cref left, value::cref right)
     {
-        auto l = left.data<d_array>();
+        std::shared_ptr<const d_array> l = left.data<d_array>();
         auto found = std::find(l->begin(), l->end(), right);
 
         if (found != l->end())
@@ -1844,7 +1905,7 @@ namespace
         auto duration = std::chrono::duration<float>(f);
         auto durationCasted = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
 
-        runtime.context_active().suspend(durationCasted);
+        runtime.context_active().suspend(runtime.now() + durationCasted);
         return {};
     }
     value cansuspend_(runtime& runtime)
@@ -1911,7 +1972,7 @@ namespace
     }
     value in_any_array(runtime& runtime, value::cref left, value::cref right)
     {
-        auto arr = right.data<d_array>();
+        std::shared_ptr<const d_array> arr = right.data<d_array>();
         auto res = std::find(arr->begin(), arr->end(), left);
         return res != arr->end();
     }
@@ -1923,7 +1984,7 @@ namespace
     }
     value time_(runtime& runtime)
     {
-        auto curtime = std::chrono::system_clock::now();
+        auto curtime = runtime.now();
         auto starttime = runtime.runtime_timestamp();
         // Time is since beginning of game so long is fine.
         long r = static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(curtime - starttime).count());
@@ -51,7 +51,7 @@ namespace sqf
         private:
             std::weak_ptr<sqf::runtime::context> m_context;
         protected:
-            bool do_equals(std::shared_ptr<sqf::runtime::data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<sqf::runtime::data>& other, bool invariant) const override
             {
                 return this == other.get();
             }
@@ -96,7 +96,7 @@ namespace sqf
             bool m_match_now;
             bool m_has_match;
         protected:
-            bool do_equals(std::shared_ptr<sqf::runtime::data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<sqf::runtime::data>& other, bool invariant) const override
             {
                 return this == other.get();
             }
@@ -148,7 +148,7 @@ namespace sqf
             float m_to;
             float m_step;
         protected:
-            bool do_equals(std::shared_ptr<sqf::runtime::data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<sqf::runtime::data>& other, bool invariant) const override
             {
                 auto of = std::static_pointer_cast<d_for>(other);
                 return m_variable == of->m_variable && m_from == of->m_from && m_to == of->m_to && m_step == of->m_step;
@@ -26,7 +26,7 @@ namespace sqf
         public:
             using data_type = sqf::runtime::t_hashmap;
         protected:
-            virtual bool do_equals(std::shared_ptr<data> other, bool invariant) const
+            virtual bool do_equals(const std::shared_ptr<data>& other, bool invariant) const
             {
                 auto& other_map = std::static_pointer_cast<d_hashmap>(other)->map();
                 auto& self_map = m_map;
@@ -40,11 +40,13 @@ namespace sqf
             sqf::runtime::type type() const override { return data_type(); }
             virtual std::size_t hash() const override
             {
+                // Entries are combined commutatively, as equal maps may iterate in different orders.
                 size_t hash = 0x9e3779b9;
                 for (auto& it : m_map)
                 {
-                    hash ^= std::hash<sqf::runtime::value>()(it.first) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-                    hash ^= std::hash<sqf::runtime::value>()(it.second) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+                    size_t entry = std::hash<sqf::runtime::value>()(it.first);
+                    entry ^= std::hash<sqf::runtime::value>()(it.second) + 0x9e3779b9 + (entry << 6) + (entry >> 2);
+                    hash += entry;
                 }
                 return hash;
             }
@@ -84,11 +84,11 @@ namespace
     }
     value equals_any_any(runtime& runtime, value::cref left, value::cref right)
     {
-        return left.data()->equals(right.data(), true);
+        return left.equals(right, true);
     }
     value notequals_any_any(runtime& runtime, value::cref left, value::cref right)
     {
-        return !left.data()->equals(right.data(), true);
+        return !left.equals(right, true);
     }
     value isequalto_any_any(runtime& runtime, value::cref left, value::cref right)
     {
@@ -13,6 +13,7 @@
 #include <cmath>
 #include <random>
 #include <array>
+#include <vector>
 #include <iomanip>
 
 
@@ -173,36 +174,58 @@ namespace
 	{
 		return right;
 	}
-	value matrixmultiply_array_array(runtime& runtime, value::cref left, value::cref right)
+	/// <summary>
+	/// Unpacks a rectangular matrix of scalars into a row-major float buffer.
+	/// Returns false (leaving rows and cols undefined) if the matrix is empty, not rectangular or contains non-scalar values.
+	/// Type errors get logged, shape errors are silent.
+	/// </summary>
+	bool unpack_matrix(runtime& runtime, const d_array& matrix, std::vector<float>& out, size_t& rows, size_t& cols)
 	{
-		auto l = left.data<d_array>();
-		auto r = right.data<d_array>();
-
 		// Check that neither rows nor first col is empty
-		if (l->size() == 0 || l->at(0).type() != t_array() || l->at(0).data<d_array>()->size() == 0) {
-			return std::make_shared<d_array>();
-		}
-		if (r->size() == 0 || r->at(0).type() != t_array() || r->at(0).data<d_array>()->size() == 0) {
-			return std::make_shared<d_array>();
+		if (matrix.empty() || !matrix.view()[0].is<t_array>() || matrix.view()[0].data<d_array>()->empty()) {
+			return false;
 		}
+		rows = matrix.size();
+		cols = matrix.view()[0].data<d_array>()->size();
 
-		size_t l_rows = l->size();
-		size_t l_cols = l->at(0).data<d_array>()->size();
-		size_t r_rows = r->size();
-		size_t r_cols = r->at(0).data<d_array>()->size();
-
-		// Check that array is n x k
-		for (size_t i = 1; i < l_rows; i++) {
-			if (l->at(i).data<d_array>()->size() != l_cols) {
-				return std::make_shared<d_array>();
+		out.clear();
+		out.reserve(rows * cols);
+		for (auto& it : matrix.view()) {
+			// Check that array is n x k
+			if (!it.is<t_array>() || it.data<d_array>()->size() != cols) {
+				return false;
 			}
-		}
-
-		// Check that array is k x m
-		for (size_t i = 1; i < r_rows; i++) {
-			if (r->at(i).data<d_array>()->size() != r_cols) {
-				return std::make_shared<d_array>();
+			std::shared_ptr<const d_array> row = it.data<d_array>();
+			if (!row->check_type(runtime, t_scalar(), cols)) {
+				return false;
 			}
+			for (auto& col : row->view()) {
+				out.push_back(col.data<d_scalar, float>());
+			}
+		}
+		return true;
+	}
+	/// <summary>
+	/// Packs a row-major float buffer back into an array of row arrays.
+	/// </summary>
+	value pack_matrix(const std::vector<float>& in, size_t rows, size_t cols)
+	{
+		std::vector<value> packed;
+		packed.reserve(rows);
+		for (size_t i = 0; i < rows; i++) {
+			std::vector<value> row(in.begin() + i * cols, in.begin() + (i + 1) * cols);
+			packed.emplace_back(std::make_shared<d_array>(std::move(row)));
+		}
+		return value(std::make_shared<d_array>(std::move(packed)));
+	}
+	value matrixmultiply_array_array(runtime& runtime, value::cref left, value::cref right)
+	{
+		std::vector<float> l;
+		std::vector<float> r;
+		size_t l_rows, l_cols, r_rows, r_cols;
+		if (!unpack_matrix(runtime, *left.data<d_array>(), l, l_rows, l_cols) ||
+			!unpack_matrix(runtime, *right.data<d_array>(), r, r_rows, r_cols)) {
+			return std::make_shared<d_array>();
 		}
 
 		// Ensure arrays are n x k and k x m
@@ -210,54 +233,36 @@ namespace
 			return std::make_shared<d_array>();
 		}
 
-		auto multiplied = std::make_shared<d_array>();
-
+		// i-k-j order keeps the innermost loop on contiguous memory (allowing the compiler to vectorize it)
+		// while every result cell still sums up its products in ascending k.
+		std::vector<float> multiplied(l_rows * r_cols, 0.0f);
 		for (size_t i = 0; i < l_rows; i++) {
-			auto row = std::make_shared<d_array>();
-			for (size_t j = 0; j < r_cols; j++) {
-				float col = 0;
-				for (size_t k = 0; k < r_rows; k++) {
-					auto l_value = l->at(i).data<d_array>()->at(k).data<d_scalar, float>();
-					auto r_value = r->at(k).data<d_array>()->at(j).data<d_scalar, float>();
-					col = col + l_value * r_value;
+			float* out_row = multiplied.data() + i * r_cols;
+			for (size_t k = 0; k < r_rows; k++) {
+				const float l_value = l[i * l_cols + k];
+				const float* r_row = r.data() + k * r_cols;
+				for (size_t j = 0; j < r_cols; j++) {
+					out_row[j] += l_value * r_row[j];
 				}
-				row->push_back(col);
 			}
-			multiplied->push_back(row);
 		}
-
-		return multiplied;
+		return pack_matrix(multiplied, l_rows, r_cols);
 	}
 	value matrixtranspose_array(runtime& runtime, value::cref left)
 	{
-		auto l = left.data<d_array>();
-
-		// Check that neither rows nor first col is empty
-		if (l->size() == 0 || l->at(0).type() != t_array() || l->at(0).data<d_array>()->size() == 0) {
+		std::vector<float> l;
+		size_t rows, cols;
+		if (!unpack_matrix(runtime, *left.data<d_array>(), l, rows, cols)) {
 			return std::make_shared<d_array>();
 		}
 
-		auto row_size = l->size();
-		auto col_size = l->at(0).data<d_array>()->size();
-
-		// Check that array is n x k
-		for (size_t i = 1; i < row_size; i++) {
-			if (l->at(i).data<d_array>()->size() != col_size) {
-				return std::make_shared<d_array>();
-			}
-		}
-
-		auto transposed = std::make_shared<d_array>();
-
-		for (size_t i = 0; i < col_size; i++) {
-			auto row = std::make_shared<d_array>();
-			for (size_t j = 0; j < row_size; j++) {
-				row->push_back(l->at(j).data<d_array>()->at(i).data<d_scalar, float>());
+		std::vector<float> transposed(l.size());
+		for (size_t i = 0; i < rows; i++) {
+			for (size_t j = 0; j < cols; j++) {
+				transposed[j * rows + i] = l[i * cols + j];
 			}
-			transposed->push_back(row);
 		}
-
-		return transposed;
+		return pack_matrix(transposed, cols, rows);
 	}
 	float dotProduct(vec3 left, vec3 right)
 	{
@@ -279,25 +284,26 @@ namespace
 	{
 		return std::sqrt(vectorDistanceSqr(left, right));
 	}
+	value to_value(vec3 v)
+	{
+		return value(std::make_shared<d_array>(std::vector<value>{ v.x, v.y, v.z }));
+	}
 	value vectoradd_array_array(runtime& runtime, value::cref left, value::cref right)
 	{
-		auto l = left.data<d_array>();
-		auto r = right.data<d_array>();
-		auto arr = std::make_shared<d_array>();
+		std::shared_ptr<const d_array> l = left.data<d_array>();
+		std::shared_ptr<const d_array> r = right.data<d_array>();
 		if (!l->check_type(runtime, t_scalar(), 3) || !r->check_type(runtime, t_scalar(), 3))
 		{
 			return {};
 		}
-		arr->push_back(l->at(0).data<d_scalar, float>() + r->at(0).data<d_scalar, float>());
-		arr->push_back(l->at(1).data<d_scalar, float>() + r->at(1).data<d_scalar, float>());
-		arr->push_back(l->at(2).data<d_scalar, float>() + r->at(2).data<d_scalar, float>());
-		return value(arr);
+		vec3 lv = *l;
+		vec3 rv = *r;
+		return to_value({ lv.x + rv.x, lv.y + rv.y, lv.z + rv.z });
 	}
 	value vectorcos_array_array(runtime& runtime, value::cref left, value::cref right)
 	{
-		auto l = left.data<d_array>();
-		auto r = right.data<d_array>();
-		auto arr = std::make_shared<d_array>();
+		std::shared_ptr<const d_array> l = left.data<d_array>();
+		std::shared_ptr<const d_array> r = right.data<d_array>();
 		if (!l->check_type(runtime, t_scalar(), 3) || !r->check_type(runtime, t_scalar(), 3))
 		{
 			return {};
@@ -306,23 +312,23 @@ namespace
 	}
 	value vectorcrossproduct_array_array(runtime& runtime, value::cref left, value::cref right)
 	{
-		auto l = left.data<d_array>();
-		auto r = right.data<d_array>();
-		auto arr = std::make_shared<d_array>();
+		std::shared_ptr<const d_array> l = left.data<d_array>();
+		std::shared_ptr<const d_array> r = right.data<d_array>();
 		if (!l->check_type(runtime, t_scalar(), 3) || !r->check_type(runtime, t_scalar(), 3))
 		{
 			return {};
 		}
-		arr->push_back(l->at(1).data<d_scalar, float>() * r->at(2).data<d_scalar, float>() - l->at(2).data<d_scalar, float>() * r->at(1).data<d_scalar, float>());
-		arr->push_back(l->at(2).data<d_scalar, float>() * r->at(0).data<d_scalar, float>() - l->at(0).data<d_scalar, float>() * r->at(2).data<d_scalar, float>());
-		arr->push_back(l->at(0).data<d_scalar, float>() * r->at(1).data<d_scalar, float>() - l->at(1).data<d_scalar, float>() * r->at(0).data<d_scalar, float>());
-		return value(arr);
+		vec3 lv = *l;
+		vec3 rv = *r;
+		return to_value({
+			lv.y * rv.z - lv.z * rv.y,
+			lv.z * rv.x - lv.x * rv.z,
+			lv.x * rv.y - lv.y * rv.x });
 	}
 	value vectordistance_array_array(runtime& runtime, value::cref left, value::cref right)
 	{
-		auto l = left.data<d_array>();
-		auto r = right.data<d_array>();
-		auto arr = std::make_shared<d_array>();
+		std::shared_ptr<const d_array> l = left.data<d_array>();
+		std::shared_ptr<const d_array> r = right.data<d_array>();
 		if (!l->check_type(runtime, t_scalar(), 3) || !r->check_type(runtime, t_scalar(), 3))
 		{
 			return {};
@@ -331,9 +337,8 @@ namespace
 	}
 	value vectordistancesqr_array_array(runtime& runtime, value::cref left, value::cref right)
 	{
-		auto l = left.data<d_array>();
-		auto r = right.data<d_array>();
-		auto arr = std::make_shared<d_array>();
+		std::shared_ptr<const d_array> l = left.data<d_array>();
+		std::shared_ptr<const d_array> r = right.data<d_array>();
 		if (!l->check_type(runtime, t_scalar(), 3) || !r->check_type(runtime, t_scalar(), 3))
 		{
 			return {};
@@ -342,36 +347,31 @@ namespace
 	}
 	value vectormultiply_array_scalar(runtime& runtime, value::cref left, value::cref right)
 	{
-		auto l = left.data<d_array>();
+		std::shared_ptr<const d_array> l = left.data<d_array>();
 		auto r = right.data<d_scalar, float>();
-		auto arr = std::make_shared<d_array>();
 		if (!l->check_type(runtime, t_scalar(), 3))
 		{
 			return {};
 		}
-		arr->push_back(l->at(0).data<d_scalar, float>() * r);
-		arr->push_back(l->at(1).data<d_scalar, float>() * r);
-		arr->push_back(l->at(2).data<d_scalar, float>() * r);
-		return value(arr);
+		vec3 lv = *l;
+		return to_value({ lv.x * r, lv.y * r, lv.z * r });
 	}
 	value vectordiff_array_array(runtime& runtime, value::cref left, value::cref right)
 	{
-		auto l = left.data<d_array>();
-		auto r = right.data<d_array>();
-		auto arr = std::make_shared<d_array>();
+		std::shared_ptr<const d_array> l = left.data<d_array>();
+		std::shared_ptr<const d_array> r = right.data<d_array>();
 		if (!l->check_type(runtime, t_scalar(), 3) || !r->check_type(runtime, t_scalar(), 3))
 		{
 			return {};
 		}
-		arr->push_back(l->at(0).data<d_scalar, float>() - r->at(0).data<d_scalar, float>());
-		arr->push_back(l->at(1).data<d_scalar, float>() - r->at(1).data<d_scalar, float>());
-		arr->push_back(l->at(2).data<d_scalar, float>() - r->at(2).data<d_scalar, float>());
-		return value(arr);
+		vec3 lv = *l;
+		vec3 rv = *r;
+		return to_value({ lv.x - rv.x, lv.y - rv.y, lv.z - rv.z });
 	}
 	value vectordotproduct_array_array(runtime& runtime, value::cref left, value::cref right)
 	{
-		auto l = left.data<d_array>();
-		auto r = right.data<d_array>();
+		std::shared_ptr<const d_array> l = left.data<d_array>();
+		std::shared_ptr<const d_array> r = right.data<d_array>();
 		if (!l->check_type(runtime, t_scalar(), 3) || !r->check_type(runtime, t_scalar(), 3))
 		{
 			return {};
@@ -380,7 +380,7 @@ namespace
 	}
 	value vectormagnitude_array(runtime& runtime, value::cref left)
 	{
-		auto l = left.data<d_array>();
+		std::shared_ptr<const d_array> l = left.data<d_array>();
 		if (!l->check_type(runtime, t_scalar(), 3))
 		{
 			return {};
@@ -389,7 +389,7 @@ namespace
 	}
 	value vectormagnitudesqr_array(runtime& runtime, value::cref left)
 	{
-		auto l = left.data<d_array>();
+		std::shared_ptr<const d_array> l = left.data<d_array>();
 		if (!l->check_type(runtime, t_scalar(), 3))
 		{
 			return {};
@@ -398,26 +398,18 @@ namespace
 	}
 	value vectornormalized_array(runtime& runtime, value::cref left)
 	{
-		auto l = left.data<d_array>();
-		auto arr = std::make_shared<d_array>();
+		std::shared_ptr<const d_array> l = left.data<d_array>();
 		if (!l->check_type(runtime, t_scalar(), 3))
 		{
 			return {};
 		}
-		auto magnitude = vectorMagnitude(*l);
+		vec3 lv = *l;
+		auto magnitude = vectorMagnitude(lv);
 		if (magnitude == 0)
 		{
-			arr->push_back(0);
-			arr->push_back(0);
-			arr->push_back(0);
-		}
-		else
-		{
-			arr->push_back(l->at(0).data<d_scalar, float>() / magnitude);
-			arr->push_back(l->at(1).data<d_scalar, float>() / magnitude);
-			arr->push_back(l->at(2).data<d_scalar, float>() / magnitude);
+			return to_value({});
 		}
-		return value(arr);
+		return to_value({ lv.x / magnitude, lv.y / magnitude, lv.z / magnitude });
 	}
 	value tofixed_scalar(runtime& runtime, value::cref right)
 	{
@@ -32,7 +32,7 @@ namespace sqf
         private:
             std::weak_ptr<sqf::runtime::value_scope> m_scope;
         protected:
-            bool do_equals(std::shared_ptr<sqf::runtime::data> other, bool ignoreCase) const override
+            bool do_equals(const std::shared_ptr<sqf::runtime::data>& other, bool ignoreCase) const override
             {
                 auto otherNs = std::static_pointer_cast<d_namespace>(other);
                 if (!m_scope.expired() && !otherNs->m_scope.expired())
@@ -540,6 +540,41 @@ namespace
         nearestobjects_distancesort2d(vec3 p) : pos({ p.x, p.y }) {}
         bool operator() (value::cref l, value::cref r) const { return l.data<d_object>()->value()->distance2d(pos) < r.data<d_object>()->value()->distance2d(pos); }
     };
+    // Resolves the type names passed to nearestObjects/nearestObject once per query.
+    // Returns an empty optional if every object matches.
+    std::optional<std::vector<config::symbol>> nearestobjects_filter(runtime& runtime, const d_array& types)
+    {
+        if (types.empty() || !runtime.configuration().enable_classname_check)
+        {
+            return {};
+        }
+        std::vector<config::symbol> name_symbols;
+        for (auto& type : types)
+        {
+            // Names no config class carries cannot match anything
+            auto name_symbol = runtime.confighost().symbol_of(type.data<d_string, std::string>());
+            if (name_symbol.has_value())
+            {
+                name_symbols.push_back(*name_symbol);
+            }
+        }
+        return name_symbols;
+    }
+    bool nearestobjects_matches(runtime& runtime, const object& obj, const std::optional<std::vector<config::symbol>>& filter)
+    {
+        if (!filter.has_value())
+        {
+            return true;
+        }
+        auto cfgObject = obj.config().navigate(runtime.confighost());
+        if (cfgObject.empty())
+        {
+            return false;
+        }
+        return std::any_of(filter->begin(), filter->end(), [&cfgObject](config::symbol name_symbol) {
+            return cfgObject.has_inherited_with_name(name_symbol);
+        });
+    }
     value nearestobjects_array(runtime& runtime, value::cref right)
     {
         auto arr = right.data<d_array>();
@@ -580,8 +615,8 @@ namespace
         for (size_t i = 0; i < filterarr->size(); i++)
         {
             if (!filterarr->at(i).is< t_string>())
-                runtime.__logmsg(err::ExpectedSubArrayTypeMissmatch(runtime.context_active().current_frame().diag_info_from_position(), std::array<size_t, 2> { 1, i }, t_string(), filterarr->at(i).type()));
             {
+                runtime.__logmsg(err::ExpectedSubArrayTypeMissmatch(runtime.context_active().current_frame().diag_info_from_position(), std::array<size_t, 2> { 1, i }, t_string(), filterarr->at(i).type()));
                 return {};
             }
         }
@@ -601,60 +636,73 @@ namespace
             }
             is2ddistance = arr->at(3).data<d_boolean, bool>();
         }
-        auto outputarr = std::make_shared<d_array>();
+        std::vector<value> output;
+        auto filter = nearestobjects_filter(runtime, *filterarr);
+        runtime.storage<object::object_storage>().query(position, radius, is2ddistance, [&](const std::shared_ptr<object>& obj) {
+            if (nearestobjects_matches(runtime, *obj, filter))
+            {
+                output.emplace_back(std::make_shared<d_object>(obj));
+            }
+        });
         if (is2ddistance)
         {
-            std::array<float, 2> position2d{ position.x, position.y };
-            for (auto& object : runtime.storage<object::object_storage>())
-            {
-                if (object->distance2d(position2d) > radius) continue;
+            std::sort(output.begin(), output.end(), nearestobjects_distancesort2d(position));
+        }
+        else
+        {
+            std::sort(output.begin(), output.end(), nearestobjects_distancesort3d(position));
+        }
+        return value(std::make_shared<d_array>(std::move(output)));
+    }
+    value nearestobject_array(runtime& runtime, value::cref right)
+    {
+        // Radius used by the engine, it cannot be changed via script.
+        constexpr float nearestobject_radius = 50.0f;
 
-                bool match = filterarr->empty() || !runtime.configuration().enable_classname_check;
-                if (!match)
+        auto arr = right.data<d_array>();
+        vec3 position{ 0, 0, 0 };
+        auto types = std::make_shared<d_array>();
+        if (arr->size() == 2 && arr->at(1).is<t_string>())
+        {
+            // nearestObject [position, type]
+            types->push_back(arr->at(1));
+            if (arr->at(0).is<t_object>())
+            {
+                if (arr->at(0).data<d_object>()->is_null())
                 {
-                    auto cfgObject = object->config().navigate(runtime.confighost());
-
-                    if (!cfgObject.empty())
-                    {
-                        auto found = std::find_if(filterarr->begin(), filterarr->end(), [&cfgObject](value::cref value) {
-                            return cfgObject.has_inherited_with_name(value.data<d_string, std::string>());
-                        });
-                        match = found != filterarr->end();
-                    }
+                    runtime.__logmsg(err::ExpectedNonNullValue(runtime.context_active().current_frame().diag_info_from_position()));
+                    return {};
                 }
-                if (match)
+                position = arr->at(0).data<d_object>()->value()->position();
+            }
+            else if (arr->at(0).is<t_array>())
+            {
+                if (!arr->at(0).data<d_array>()->check_type(runtime, t_scalar(), 2, 3))
                 {
-                    outputarr->push_back(value(std::make_shared<d_object>(object)));
+                    return {};
                 }
+                position = *arr->at(0).data<d_array>();
+            }
+            else
+            {
+                runtime.__logmsg(err::ExpectedArrayTypeMissmatch(runtime.context_active().current_frame().diag_info_from_position(), 0, std::array<sqf::runtime::type, 2> { t_array(), t_object() }, arr->at(0).type()));
+                return {};
             }
-            std::sort(outputarr->begin(), outputarr->end(), nearestobjects_distancesort2d(position2d));
         }
         else
         {
-            for (auto& object : runtime.storage<object::object_storage>())
+            // nearestObject position
+            if (!arr->check_type(runtime, t_scalar(), 2, 3))
             {
-                if (object->distance3d(position) > radius) continue;
-                
-                bool match = filterarr->empty() || !runtime.configuration().enable_classname_check;
-                if (!match)
-                {
-                    auto cfgObject = object->config().navigate(runtime.confighost());
-                    if (!cfgObject.empty())
-                    {
-                        auto found = std::find_if(filterarr->begin(), filterarr->end(), [&cfgObject](value::cref value) {
-                            return cfgObject.has_inherited_with_name(value.data<d_string, std::string>());
-                            });
-                        match = found != filterarr->end();
-                    }
-                }
-                if (match)
-                {
-                    outputarr->push_back(value(std::make_shared<d_object>(object)));
-                }
+                return {};
             }
-            std::sort(outputarr->begin(), outputarr->end(), nearestobjects_distancesort3d(position));
+            position = *arr;
         }
-        return value(outputarr);
+        auto filter = nearestobjects_filter(runtime, *types);
+        auto found = runtime.storage<object::object_storage>().nearest(position, 1, nearestobject_radius, false, [&](const std::shared_ptr<object>& obj) {
+            return nearestobjects_matches(runtime, *obj, filter);
+        });
+        return std::make_shared<d_object>(found.empty() ? std::shared_ptr<object>() : found.front());
     }
     value isnull_object(runtime& runtime, value::cref right)
     {
@@ -677,14 +725,25 @@ namespace
     }
     value allunits_(runtime& runtime)
     {
-        auto arr = std::make_shared<d_array>();
-        for (auto& object : runtime.storage<object::object_storage>())
+        auto& units = runtime.storage<object::object_storage>().units();
+        std::vector<value> arr;
+        arr.reserve(units.size());
+        for (auto& object : units)
         {
-            if (object->is_vehicle())
-                continue;
-            arr->push_back(value(std::make_shared<d_object>(object)));
+            arr.emplace_back(std::make_shared<d_object>(object));
         }
-        return value(arr);
+        return value(std::make_shared<d_array>(std::move(arr)));
+    }
+    value vehicles_(runtime& runtime)
+    {
+        auto& vehicles = runtime.storage<object::object_storage>().vehicles();
+        std::vector<value> arr;
+        arr.reserve(vehicles.size());
+        for (auto& object : vehicles)
+        {
+            arr.emplace_back(std::make_shared<d_object>(object));
+        }
+        return value(std::make_shared<d_array>(std::move(arr)));
     }
     value iskindof_object_string(runtime& runtime, value::cref left, value::cref right)
     {
@@ -741,7 +800,7 @@ namespace
                 std::vector<std::string> path;
                 do
                 {
-                    path.push_back(nav->name);
+                    path.push_back(std::string(nav->name));
                     nav = nav.parent_logical();
                 } while (nav->id_parent_logical != config::invalid_id);
                 runtime.__logmsg(err::ConfigEntryNotFoundWeak(runtime.context_active().current_frame().diag_info_from_position(), path, test_type_str));
@@ -1089,6 +1148,7 @@ void sqf::operators::ops_object(sqf::runtime::runtime& runtime)
     using namespace sqf::runtime::sqfop;
 
     runtime.register_sqfop(unary("units", t_object(), "Returns an array with all the units in the group of the unit. For a destroyed object an empty array is returned.", units_object));
+    runtime.register_sqfop(nular("vehicles", "Returns an array of all vehicles.", vehicles_));
     runtime.register_sqfop(nular("allUnits", "Return a list of all units (all persons except agents) outside and inside vehicles.", allunits_));
     runtime.register_sqfop(nular("objNull", "A non-existent Object. To compare non-existent objects use isNull or isEqualTo.", objnull_));
     runtime.register_sqfop(unary("typeOf", t_object(), "Returns the config class name of given object.", typeof_object));
@@ -1114,6 +1174,7 @@ void sqf::operators::ops_object(sqf::runtime::runtime& runtime)
     runtime.register_sqfop(binary(4, "distance2d", t_array(), t_object(), "Returns a 2d distance in meters between two positions.", distance2d_array_object));
     runtime.register_sqfop(binary(4, "distance2d", t_object(), t_object(), "Returns a 2d distance in meters between two positions.", distance2d_object_object));
     runtime.register_sqfop(unary("nearestObjects", t_array(), "Returns a list of nearest objects of the given types to the given position or object, within the specified distance. If more than one object is found they will be ordered by proximity, the closest one will be first in the array.", nearestobjects_array));
+    runtime.register_sqfop(unary("nearestObject", t_array(), "Returns the nearest object of given type to given position within a radius of 50 meters. Without a type, the nearest object of any type is returned.", nearestobject_array));
     runtime.register_sqfop(unary("isNull", t_object(), "Checks whether the tested item is Null.", isnull_object));
     runtime.register_sqfop(unary("side", t_object(), "Returns the side of an object.", side_object));
     runtime.register_sqfop(binary(4, "isKindOf", t_object(), t_string(), "Checks whether the object is (a subtype) of the given type.", iskindof_object_string));
@@ -359,6 +359,31 @@ namespace
         runtime.parser_config().parse(runtime.confighost(), str, runtime.context_active().current_frame().diag_info_from_position());
         return {};
     }
+    value configresolve___(runtime& runtime)
+    {
+        runtime.confighost().resolve();
+        return {};
+    }
+    value configunresolve___(runtime& runtime)
+    {
+        runtime.confighost().unresolve_all();
+        return {};
+    }
+    value configfreeze___(runtime& runtime)
+    {
+        runtime.confighost().freeze();
+        return {};
+    }
+    value virtualtime___bool(runtime& runtime, value::cref right)
+    {
+        runtime.configuration().virtual_time = right.data<d_boolean, bool>();
+        return {};
+    }
+    value walltime___(runtime& runtime)
+    {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - runtime.runtime_timestamp_steady()).count();
+        return { (float)(elapsed * 0.001) };
+    }
     value allObjects__(runtime& runtime)
     {
         auto arr = std::make_shared<d_array>();
@@ -368,6 +393,11 @@ namespace
         }
         return value(arr);
     }
+    value dispatchstats___(runtime& runtime)
+    {
+        auto& stats = runtime.sqfop_cache_stats();
+        return std::vector<value> { stats.hits, stats.misses };
+    }
     value exit___(runtime& runtime)
     {
         runtime.exit(0);
@@ -774,6 +804,11 @@ void sqf::operators::ops_sqfvm(sqf::runtime::runtime& runtime)
     runtime.register_sqfop(nular("cmdsimplemented__", "Returns an array containing all commands that are actually implemented.", cmdsimplemented___));
     runtime.register_sqfop(unary("help__", t_string(), "Displays all available information for a single command.", help___string));
     runtime.register_sqfop(unary("configparse__", t_string(), "Parses provided string as config into a new config object.", configparse___string));
+    runtime.register_sqfop(nular("configresolve__", "Flattens the config, making lookups of inherited entries a single search. Later config changes are kept up to date.", configresolve___));
+    runtime.register_sqfop(nular("configunresolve__", "Drops the flattened config view (see configResolve__), freeing its memory.", configunresolve___));
+    runtime.register_sqfop(unary("virtualTime__", t_boolean(), "Enables or disables the virtual runtime clock (see --virtual-time). While enabled, the clock skips ahead to the next wakeup whenever all scripts are suspended.", virtualtime___bool));
+    runtime.register_sqfop(nular("wallTime__", "Seconds of wall clock time passed since the start of the runtime. Unlike time and diag_tickTime, this is not affected by virtualTime__.", walltime___));
+    runtime.register_sqfop(nular("configfreeze__", "Freezes the current config into an immutable snapshot. Later config changes only copy the affected classes on top of it.", configfreeze___));
     // runtime.register_sqfop(binary(4, "merge__", t_config(), t_config(), "Merges contents from the right config into the left config. Duplicate entries will be overriden. Contents will not be copied but referenced.", merge___config_config));
     runtime.register_sqfop(nular("allObjects__", "Returns an array containing all objects created.", allObjects__));
     // runtime.register_sqfop(unary("pretty__", t_code(), "Takes provided SQF code and pretty-prints it to output.", pretty___code));
@@ -789,6 +824,7 @@ void sqf::operators::ops_sqfvm(sqf::runtime::runtime& runtime)
     runtime.register_sqfop(unary("assembly__", t_code(), "returns an array, containing the assembly instructions as string.", assembly___code));
     runtime.register_sqfop(unary("assembly__", t_string(), "returns an array, containing the assembly instructions as string.", assembly___string));
     runtime.register_sqfop(binary(4, "except__", t_code(), t_code(), "Allows to define a block that catches VM exceptions. It is to note, that this will also catch exceptions in spawn! Exception will be put into the magic variable '_exception'. A callstack is available in '_callstack'.", except___code_code));
+    runtime.register_sqfop(nular("dispatchStats__", "Returns the hit and miss counters of the operator inline caches as [hits, misses].", dispatchstats___));
     runtime.register_sqfop(nular("callstack__", "Returns an array containing the whole callstack.", callstack___));
     runtime.register_sqfop(unary("allFiles__", t_array(),
         "Returns all files available in that path with the given file extensions." " "
@@ -15,7 +15,19 @@
 using namespace std::string_literals;
 using namespace std::string_view_literals;
 
-sqf::runtime::value sqf::parser::assembly::parser::get_value(::sqf::runtime::runtime& runtime, std::string_view contents, const ::sqf::parser::assembly::bison::astnode& node)
+namespace sqf::parser::assembly::util
+{
+    static ::sqf::runtime::diagnostics::source_location location_of(const std::shared_ptr<::sqf::runtime::diagnostics::source_file>& source, const ::sqf::parser::assembly::tokenizer::token& token, size_t column)
+    {
+        return { source, source->path_id(*token.path), token.line, column, token.offset, token.contents.length() };
+    }
+    static ::sqf::runtime::diagnostics::source_location location_of(const std::shared_ptr<::sqf::runtime::diagnostics::source_file>& source, const ::sqf::parser::assembly::tokenizer::token& token)
+    {
+        return location_of(source, token, token.column);
+    }
+}
+
+sqf::runtime::value sqf::parser::assembly::parser::get_value(::sqf::runtime::runtime& runtime, const std::shared_ptr<::sqf::runtime::diagnostics::source_file>& source, const ::sqf::parser::assembly::bison::astnode& node)
 {
     switch (node.kind)
     {
@@ -68,7 +80,7 @@ sqf::runtime::value sqf::parser::assembly::parser::get_value(::sqf::runtime::run
             for (size_t i = 0; i < node.children.size(); i++)
             {
                 previous_node = node.children[i];
-                to_assembly(runtime, contents, previous_node, tmp_set);
+                to_assembly(runtime, source, previous_node, tmp_set);
             }
             auto inst_set = ::sqf::runtime::instruction_set(tmp_set);
             return ::sqf::runtime::value(std::make_shared<::sqf::types::d_code>(inst_set));
@@ -79,31 +91,31 @@ sqf::runtime::value sqf::parser::assembly::parser::get_value(::sqf::runtime::run
             std::vector<::sqf::runtime::value> values;
             for (auto& subnode : node.children)
             {
-                values.push_back(get_value(runtime, contents, subnode));
+                values.push_back(get_value(runtime, source, subnode));
             }
             return ::sqf::runtime::value(std::make_shared<::sqf::types::d_array>(values));
         }
         break;
     }
 }
-void ::sqf::parser::assembly::parser::to_assembly(::sqf::runtime::runtime& runtime, std::string_view contents, const ::sqf::parser::assembly::bison::astnode& node, std::vector<::sqf::runtime::instruction::sptr>& set)
+void ::sqf::parser::assembly::parser::to_assembly(::sqf::runtime::runtime& runtime, const std::shared_ptr<::sqf::runtime::diagnostics::source_file>& source, const ::sqf::parser::assembly::bison::astnode& node, std::vector<::sqf::runtime::instruction::sptr>& set)
 {
 
     switch (node.kind)
     {
         case bison::astkind::ASSIGN_TO: {
             auto inst = std::make_shared<::sqf::opcodes::assign_to>(::sqf::types::d_string::from_sqf(node.children[1].token.contents));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             set.push_back(inst);
         } break;
         case bison::astkind::ASSIGN_TO_LOCAL: {
             auto inst = std::make_shared<::sqf::opcodes::assign_to_local>(::sqf::types::d_string::from_sqf(node.children[1].token.contents));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             set.push_back(inst);
         } break;
         case bison::astkind::GET_VARIABLE: {
             auto inst = std::make_shared<::sqf::opcodes::get_variable>(::sqf::types::d_string::from_sqf(node.children[1].token.contents));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             set.push_back(inst);
         } break;
         case bison::astkind::CALL_BINARY: {
@@ -120,23 +132,23 @@ void ::sqf::parser::assembly::parser::to_assembly(::sqf::runtime::runtime& runti
                 auto prec = binary_ops.begin()->get().precedence();
 
                 auto inst = std::make_shared<::sqf::opcodes::call_binary>(str, prec);
-                inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+                inst->location(util::location_of(source, node.token));
                 set.push_back(inst);
             }
         } break;
         case bison::astkind::CALL_UNARY: {
             auto inst = std::make_shared<::sqf::opcodes::call_unary>(std::string(node.children[1].token.contents));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             set.push_back(inst);
         } break;
         case bison::astkind::CALL_NULAR: {
             auto inst = std::make_shared<::sqf::opcodes::call_nular>(std::string(node.children[1].token.contents));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             set.push_back(inst);
         } break;
         case bison::astkind::END_STATEMENT: {
             auto inst = std::make_shared<::sqf::opcodes::end_statement>();
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             set.push_back(inst);
         } break;
         case bison::astkind::PUSH:
@@ -149,11 +161,11 @@ void ::sqf::parser::assembly::parser::to_assembly(::sqf::runtime::runtime& runti
                 if (i != 0)
                 {
                     auto inst = std::make_shared<::sqf::opcodes::end_statement>();
-                    inst->diag_info({ previous_node.token.line, previous_node.token.column + previous_node.token.contents.length(), previous_node.token.offset, { *previous_node.token.path, {} }, create_code_segment(contents, previous_node.token.offset, previous_node.token.contents.length()) });
+                    inst->location(util::location_of(source, previous_node.token, previous_node.token.column + previous_node.token.contents.length()));
                     set.push_back(inst);
                 }
                 previous_node = node.children[i];
-                to_assembly(runtime, contents, previous_node, set);
+                to_assembly(runtime, source, previous_node, set);
             }
         }
     }
@@ -168,7 +180,8 @@ bool sqf::parser::assembly::parser::get_tree(::sqf::runtime::runtime& runtime, :
 
 std::optional<sqf::runtime::instruction_set> sqf::parser::assembly::parser::parse(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file)
 {
-    tokenizer t(contents.begin(), contents.end(), file.physical);
+    auto source = std::make_shared<::sqf::runtime::diagnostics::source_file>(std::move(contents));
+    tokenizer t(source->buffer().begin(), source->buffer().end(), file.physical);
     ::sqf::parser::assembly::bison::astnode res;
     ::sqf::parser::assembly::bison::parser p(t, res, *this, runtime);
     // p.set_debug_level(1);
@@ -178,7 +191,7 @@ std::optional<sqf::runtime::instruction_set> sqf::parser::assembly::parser::pars
         return {};
     }
     std::vector<::sqf::runtime::instruction::sptr> vec;
-    to_assembly(runtime, contents, res, vec);
+    to_assembly(runtime, source, res, vec);
     return vec;
 }
 
@@ -2,6 +2,7 @@
 #include "../../runtime/parser/sqf.h"
 #include "../../runtime/logging.h"
 #include "../../runtime/diagnostics/diag_info.h"
+#include "../../runtime/diagnostics/source_location.h"
 #include "../../runtime/fileio.h"
 #include "../../runtime/util.h"
 #include "../../runtime/value.h"
@@ -23,8 +24,8 @@ namespace sqf::parser::assembly
     class parser : public ::sqf::runtime::parser::sqf, public CanLog
     {
     private:
-        ::sqf::runtime::value get_value(::sqf::runtime::runtime& runtime, std::string_view contents, const ::sqf::parser::assembly::bison::astnode& node);
-        void to_assembly(::sqf::runtime::runtime& runtime, std::string_view contents, const ::sqf::parser::assembly::bison::astnode& node, std::vector<::sqf::runtime::instruction::sptr>& set);
+        ::sqf::runtime::value get_value(::sqf::runtime::runtime& runtime, const std::shared_ptr<::sqf::runtime::diagnostics::source_file>& source, const ::sqf::parser::assembly::bison::astnode& node);
+        void to_assembly(::sqf::runtime::runtime& runtime, const std::shared_ptr<::sqf::runtime::diagnostics::source_file>& source, const ::sqf::parser::assembly::bison::astnode& node, std::vector<::sqf::runtime::instruction::sptr>& set);
     public:
         parser(Logger& logger) : CanLog(logger)
         {
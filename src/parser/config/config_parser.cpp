@@ -8,6 +8,8 @@
 #include <algorithm>
 #include <charconv>
 #include <sstream>
+#include <cstring>
+#include <unordered_set>
 
 
 #ifdef DF__SQF_CONFIG__REPORT_PROGRESS_BY_LINE
@@ -18,6 +20,153 @@
 
 namespace err = logmessage::config;
 
+// Appends the array inherited by the logical parent in front of the value of nav (`name[] += {...}`).
+static void prepend_inherited_array(::sqf::runtime::confignav nav, std::string_view name)
+{
+    auto parent_inherited = nav.parent_logical().parent_inherited();
+    auto inherited_value_field = parent_inherited / name;
+    if (!inherited_value_field.empty())
+    {
+        auto self = nav->value.data_try<sqf::types::d_array>();
+        auto inherited = inherited_value_field->value.data_try<sqf::types::d_array>();
+        if (self.get() && inherited.get())
+        {
+            // Read-only access to inherited, it may be part of a snapshot shared with other confighosts
+            self->insert(self->begin(), inherited->cbegin(), inherited->cend());
+        }
+    }
+}
+
+// Reader for rapified configs. Fails (sticky) instead of reading out of bounds.
+class sqf::parser::config::rapified_reader
+{
+    std::string_view m_data;
+    size_t m_position;
+    bool m_failed;
+    // Offsets of all class bodies read so far, each body may only be referenced once.
+    std::unordered_set<size_t> m_bodies;
+public:
+    rapified_reader(std::string_view data) : m_data(data), m_position(0), m_failed(false), m_bodies() {}
+    bool failed() const { return m_failed; }
+    void fail() { m_failed = true; }
+    // Marks the class body at offset as read, returns false if it was read before.
+    bool visit_body(size_t offset) { return m_bodies.insert(offset).second; }
+    size_t position() const { return m_position; }
+    void seek(size_t position)
+    {
+        if (position > m_data.length())
+        {
+            m_failed = true;
+            return;
+        }
+        m_position = position;
+    }
+    std::string_view bytes(size_t length)
+    {
+        if (m_failed || m_data.length() - m_position < length)
+        {
+            m_failed = true;
+            return {};
+        }
+        auto view = m_data.substr(m_position, length);
+        m_position += length;
+        return view;
+    }
+    template<typename T>
+    T read()
+    {
+        T val{};
+        auto view = bytes(sizeof(T));
+        if (!m_failed)
+        {
+            std::memcpy(&val, view.data(), sizeof(T)); // Rapified configs are little endian, as are all platforms SQF-VM runs on
+        }
+        return val;
+    }
+    std::string_view asciiz()
+    {
+        if (m_failed)
+        {
+            return {};
+        }
+        auto end = m_data.find('\0', m_position);
+        if (end == std::string_view::npos)
+        {
+            m_failed = true;
+            return {};
+        }
+        auto view = m_data.substr(m_position, end - m_position);
+        m_position = end + 1;
+        return view;
+    }
+    uint32_t compressed()
+    { // 7 bits per byte, high bit set if another byte follows
+        uint32_t val = 0;
+        for (uint32_t shift = 0; shift < 32; shift += 7)
+        {
+            auto byte = read<uint8_t>();
+            val |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return val;
+            }
+        }
+        m_failed = true;
+        return 0;
+    }
+    sqf::runtime::value array(size_t depth)
+    {
+        auto count = compressed();
+        if (depth > 64 || count > m_data.length() - m_position)
+        { // Every element takes at least one byte
+            m_failed = true;
+            return {};
+        }
+        std::vector<sqf::runtime::value> values;
+        values.reserve(count);
+        for (uint32_t i = 0; i < count && !m_failed; i++)
+        {
+            switch (read<uint8_t>())
+            {
+            case 0: // string
+            case 4: // variable
+                values.emplace_back(std::make_shared<sqf::types::d_string>(asciiz()));
+                break;
+            case 1:
+                values.emplace_back(std::make_shared<sqf::types::d_scalar>(read<float>()));
+                break;
+            case 2:
+                values.emplace_back(std::make_shared<sqf::types::d_scalar>(read<int32_t>()));
+                break;
+            case 3:
+                values.push_back(array(depth + 1));
+                break;
+            case 6:
+                values.emplace_back(std::make_shared<sqf::types::d_scalar>(read<int64_t>()));
+                break;
+            default:
+                m_failed = true;
+                break;
+            }
+        }
+        return std::make_shared<sqf::types::d_array>(std::move(values));
+    }
+};
+
+::sqf::runtime::confignav sqf::parser::config::parser::apply_class(::sqf::parser::config::bison::astnode& node, ::sqf::runtime::confignav parent)
+{
+    if (node.kind == ::sqf::parser::config::bison::astkind::CLASS_DEF)
+    {
+        return parent.append_or_replace(node.children[0].token.contents);
+    }
+    auto nav = parent.append_or_replace(node.children[0].token.contents, node.children[1].token.contents);
+    if (nav.parent_inherited().empty())
+    {
+        __log(err::InheritedParentNotFound({ *node.token.path, node.token.line, node.token.column }, node.children[0].token.contents, node.children[1].token.contents));
+    }
+    return nav;
+}
+
 bool sqf::parser::config::parser::apply_to_confighost(::sqf::parser::config::bison::astnode& node, ::sqf::runtime::confighost& confighost, ::sqf::runtime::confignav parent)
 {
     using namespace std::string_literals;
@@ -26,33 +175,9 @@ bool sqf::parser::config::parser::apply_to_confighost(::sqf::parser::config::bis
     switch (node.kind)
     {
         
-           case ::sqf::parser::config::bison::astkind::CLASS_DEF: {
-               parent.append_or_replace(node.children[0].token.contents);
-           } break;
+           case ::sqf::parser::config::bison::astkind::CLASS_DEF:
            case ::sqf::parser::config::bison::astkind::CLASS_DEF_EXT: {
-               auto nav = parent.append_or_replace(node.children[0].token.contents, node.children[1].token.contents);
-               if (nav.parent_inherited().empty())
-               {
-                   __log(err::InheritedParentNotFound({ *node.token.path, node.token.line, node.token.column }, node.children[0].token.contents, node.children[1].token.contents));
-               }
-           } break;
-           case ::sqf::parser::config::bison::astkind::CLASS: {
-               auto nav = parent.append_or_replace(node.children[0].token.contents);
-               for (auto subnode : node.children[1].children)
-               {
-                   apply_to_confighost(subnode, confighost, nav);
-               }
-           } break;
-           case ::sqf::parser::config::bison::astkind::CLASS_EXT: {
-               auto nav = parent.append_or_replace(node.children[0].token.contents, node.children[1].token.contents);
-               if (nav.parent_inherited().empty())
-               {
-                   __log(err::InheritedParentNotFound({ *node.token.path, node.token.line, node.token.column }, node.children[0].token.contents, node.children[1].token.contents));
-               }
-               for (auto subnode : node.children[2].children)
-               {
-                   apply_to_confighost(subnode, confighost, nav);
-               }
+               apply_class(node, parent);
            } break;
            case ::sqf::parser::config::bison::astkind::DELETE_CLASS: {
                parent.delete_inherited_or_replace(node.children[0].token.contents);
@@ -68,18 +193,7 @@ bool sqf::parser::config::parser::apply_to_confighost(::sqf::parser::config::bis
            case ::sqf::parser::config::bison::astkind::FIELD_ARRAY_APPEND: {
                auto nav = parent.append_or_replace(node.children[0].token.contents);
                apply_to_confighost(node.children[1], confighost, nav);
-
-               auto parent_inherited = nav.parent_logical().parent_inherited();
-               auto inherited_value_field = parent_inherited / std::string(node.children[0].token.contents.data(), node.children[0].token.contents.length());
-               if (!inherited_value_field.empty())
-               {
-                   auto self = nav->value.data_try<sqf::types::d_array>();
-                   auto inherited = inherited_value_field->value.data_try<sqf::types::d_array>();
-                   if (self.get() && inherited.get())
-                   {
-                       self->insert(self->begin(), inherited->begin(), inherited->end());
-                   }
-               }
+               prepend_inherited_array(nav, node.children[0].token.contents);
            } break;
            case ::sqf::parser::config::bison::astkind::NUMBER_DECIMAL: {
                try
@@ -118,7 +232,7 @@ bool sqf::parser::config::parser::apply_to_confighost(::sqf::parser::config::bis
                    values.push_back(parent->value);
                }
                // Set parents value to the actual value
-               parent.value(sqf::runtime::value(std::make_shared<sqf::types::d_array>(values)));
+               parent.value(sqf::runtime::value(std::make_shared<sqf::types::d_array>(std::move(values))));
            } break;
            case ::sqf::parser::config::bison::astkind::ANYSTRING: {
                auto start = node.children.front().token.contents.data();
@@ -152,27 +266,164 @@ bool sqf::parser::config::parser::apply_to_confighost(::sqf::parser::config::bis
 }
 
 
+void sqf::parser::config::builder::open(::sqf::parser::config::bison::astnode& node)
+{
+    if (!m_target)
+    {
+        return;
+    }
+    auto parent = m_navs.empty() ? m_target->root() : m_navs.back();
+    m_navs.push_back(m_parser.apply_class(node, parent));
+}
+void sqf::parser::config::builder::close()
+{
+    if (!m_target)
+    {
+        return;
+    }
+    m_navs.pop_back();
+}
+void sqf::parser::config::builder::apply(::sqf::parser::config::bison::astnode& node)
+{
+    if (!m_target)
+    {
+        return;
+    }
+    auto parent = m_navs.empty() ? m_target->root() : m_navs.back();
+    m_parser.apply_to_confighost(node, *m_target, parent);
+}
+
 bool sqf::parser::config::parser::check_syntax(std::string contents, ::sqf::runtime::fileio::pathinfo pathinfo)
 {
     tokenizer t(contents.begin(), contents.end(), pathinfo.physical);
-    ::sqf::parser::config::bison::astnode res;
-    ::sqf::parser::config::bison::parser p(t, res, *this);
+    builder b(*this, nullptr);
+    ::sqf::parser::config::bison::parser p(t, b, *this);
     bool success = p.parse() == 0;
     return success;
 }
 
 bool sqf::parser::config::parser::parse(::sqf::runtime::confighost& target, std::string contents, ::sqf::runtime::fileio::pathinfo pathinfo)
 {
-    tokenizer t(contents.begin(), contents.end(), pathinfo.physical);
-    ::sqf::parser::config::bison::astnode res;
-    ::sqf::parser::config::bison::parser p(t, res, *this);
-    // p.set_debug_level(1);
-    bool success = p.parse() == 0;
-    if (!success)
+    // Statements are applied while parsing, hence no syntax tree of the whole config is ever kept.
+    // On errors, the statements applied up to that point are undone again.
+    auto owns_transaction = target.begin_transaction();
+    bool success;
+    if (is_rapified(contents))
+    {
+        success = parse_rapified(target, contents, pathinfo);
+    }
+    else
     {
-        return {};
+        tokenizer t(contents.begin(), contents.end(), pathinfo.physical);
+        builder b(*this, &target);
+        ::sqf::parser::config::bison::parser p(t, b, *this);
+        // p.set_debug_level(1);
+        success = p.parse() == 0;
     }
-    std::vector<::sqf::runtime::instruction::sptr> vec;
-    auto root = target.root();
-    return apply_to_confighost(res, target, root);
+    if (owns_transaction)
+    {
+        if (success)
+        {
+            target.commit_transaction();
+        }
+        else
+        {
+            target.rollback_transaction();
+        }
+    }
+    return success;
+}
+
+bool sqf::parser::config::parser::is_rapified(std::string_view contents)
+{
+    using namespace std::string_view_literals;
+    return contents.substr(0, 4) == "\0raP"sv;
+}
+
+bool sqf::parser::config::parser::apply_rapified_body(rapified_reader& reader, ::sqf::runtime::confignav parent, const ::sqf::runtime::fileio::pathinfo& pathinfo, size_t depth)
+{
+    auto count = reader.compressed();
+    for (uint32_t i = 0; i < count && !reader.failed(); i++)
+    {
+        switch (reader.read<uint8_t>())
+        {
+        case 0: { // class
+            auto name = reader.asciiz();
+            auto offset = reader.read<uint32_t>();
+            // Offsets referenced more than once would make crafted files read the same bodies over and over
+            if (reader.failed() || depth > 64 || !reader.visit_body(offset))
+            {
+                reader.fail();
+                break;
+            }
+            auto position = reader.position();
+            reader.seek(offset);
+            auto inherited = reader.asciiz();
+            auto nav = parent.append_or_replace(name, inherited);
+            if (!inherited.empty() && nav.parent_inherited().empty())
+            {
+                __log(err::InheritedParentNotFound({ pathinfo.physical, 0, offset }, name, inherited));
+            }
+            apply_rapified_body(reader, nav, pathinfo, depth + 1);
+            reader.seek(position);
+        } break;
+        case 1: { // value
+            auto type = reader.read<uint8_t>();
+            auto nav = parent.append_or_replace(reader.asciiz());
+            switch (type)
+            {
+            case 0:
+                nav.value(std::make_shared<sqf::types::d_string>(reader.asciiz()));
+                break;
+            case 1:
+                nav.value(std::make_shared<sqf::types::d_scalar>(reader.read<float>()));
+                break;
+            case 2:
+                nav.value(std::make_shared<sqf::types::d_scalar>(reader.read<int32_t>()));
+                break;
+            case 6:
+                nav.value(std::make_shared<sqf::types::d_scalar>(reader.read<int64_t>()));
+                break;
+            default:
+                reader.fail();
+                break;
+            }
+        } break;
+        case 2: { // array
+            auto nav = parent.append_or_replace(reader.asciiz());
+            nav.value(reader.array(0));
+        } break;
+        case 3: // extern class
+            parent.append_or_replace(reader.asciiz());
+            break;
+        case 4: // delete class
+            parent.delete_inherited_or_replace(reader.asciiz());
+            break;
+        case 5: { // array append
+            reader.read<uint32_t>();
+            auto name = reader.asciiz();
+            auto nav = parent.append_or_replace(name);
+            nav.value(reader.array(0));
+            prepend_inherited_array(nav, name);
+        } break;
+        default:
+            reader.fail();
+            break;
+        }
+    }
+    return !reader.failed();
+}
+
+bool sqf::parser::config::parser::parse_rapified(::sqf::runtime::confighost& target, std::string_view contents, ::sqf::runtime::fileio::pathinfo pathinfo)
+{
+    // Header: "\0raP", two reserved integers and the offset of the enums (not supported) at the end of the file
+    rapified_reader reader(contents);
+    reader.bytes(16);
+    reader.asciiz(); // Inherited name of the root, always empty
+    if (!is_rapified(contents) || !apply_rapified_body(reader, target.root(), pathinfo, 0))
+    {
+        __log(err::ParseError({ pathinfo.physical, 0, reader.position() }, "Malformed rapified config."));
+        return false;
+    }
+    return true;
 }
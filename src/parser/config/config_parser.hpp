@@ -20,10 +20,34 @@ namespace sqf::parser::config::bison
 }
 namespace sqf::parser::config
 {
+    class rapified_reader;
+    class parser;
+
+    /// <summary>
+    /// Receives the statements of a config from the grammar actions and applies them to a confighost right away.
+    /// Classes are opened before their body gets parsed, so at most the value of a single field is kept as syntax tree.
+    /// Without a target (eg. when only checking the syntax), all statements are dropped.
+    /// </summary>
+    class builder
+    {
+    private:
+        parser& m_parser;
+        ::sqf::runtime::confighost* m_target;
+        std::vector<::sqf::runtime::confignav> m_navs;
+    public:
+        builder(parser& p, ::sqf::runtime::confighost* target) : m_parser(p), m_target(target), m_navs() {}
+        void open(::sqf::parser::config::bison::astnode& node);
+        void close();
+        void apply(::sqf::parser::config::bison::astnode& node);
+    };
+
     class parser : public ::sqf::runtime::parser::config, public CanLog
     {
+        friend class builder;
     private:
+        ::sqf::runtime::confignav apply_class(::sqf::parser::config::bison::astnode& node, ::sqf::runtime::confignav parent);
         bool apply_to_confighost(::sqf::parser::config::bison::astnode& node, ::sqf::runtime::confighost& confighost, ::sqf::runtime::confignav parent);
+        bool apply_rapified_body(rapified_reader& reader, ::sqf::runtime::confignav parent, const ::sqf::runtime::fileio::pathinfo& pathinfo, size_t depth);
     public:
         parser(Logger& logger) : CanLog(logger)
         {
@@ -36,5 +60,12 @@ namespace sqf::parser::config
         virtual ~parser() override { };
         virtual bool check_syntax(std::string contents, ::sqf::runtime::fileio::pathinfo pathinfo) override;
         virtual bool parse(::sqf::runtime::confighost& target, std::string contents, ::sqf::runtime::fileio::pathinfo pathinfo) override;
+
+        /// <summary>
+        /// Checks whether the provided contents are a rapified (binarized) config, eg. a config.bin.
+        /// Rapified configs must not be preprocessed, parse will detect and load them directly.
+        /// </summary>
+        static bool is_rapified(std::string_view contents);
+        bool parse_rapified(::sqf::runtime::confighost& target, std::string_view contents, ::sqf::runtime::fileio::pathinfo pathinfo);
     };
 }
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -29,8 +29,13 @@
 
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
-// //                    "%code top" blocks.
-#line 10 "parser.y" // lalr1.cc:397
+
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+// "%code top" blocks.
+#line 10 "parser.y"
 
     #ifdef __GNUG__
         #pragma GCC diagnostic push
@@ -44,38 +49,27 @@
     #include <vector>
     #include <algorithm>
 
-#line 48 "parser.tab.cc" // lalr1.cc:397
+#line 53 "parser.tab.cc"
 
 
-// First part of user declarations.
 
-#line 53 "parser.tab.cc" // lalr1.cc:404
-
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
-#  else
-#   define YY_NULLPTR 0
-#  endif
-# endif
 
 #include "parser.tab.hh"
 
-// User implementation prologue.
 
-#line 67 "parser.tab.cc" // lalr1.cc:412
 // Unqualified %code blocks.
-#line 100 "parser.y" // lalr1.cc:413
+#line 99 "parser.y"
 
     
     #include "../../runtime/runtime.h"
+    #include "config_parser.hpp"
      namespace sqf::parser::config::bison
      {
           // Return the next token.
           parser::symbol_type yylex (::sqf::parser::config::tokenizer&);
      }
 
-#line 79 "parser.tab.cc" // lalr1.cc:413
+#line 73 "parser.tab.cc"
 
 
 #ifndef YY_
@@ -90,6 +84,16 @@
 # endif
 #endif
 
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
 #define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -107,13 +111,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if YYDEBUG
 
@@ -126,7 +127,7 @@
     {                                           \
       *yycdebug_ << Title << ' ';               \
       yy_print_ (*yycdebug_, Symbol);           \
-      *yycdebug_ << std::endl;                  \
+      *yycdebug_ << '\n';                       \
     }                                           \
   } while (false)
 
@@ -139,15 +140,15 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !YYDEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE(Symbol)
-# define YY_REDUCE_PRINT(Rule)           static_cast<void>(0)
-# define YY_STACK_PRINT()                static_cast<void>(0)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
 
 #endif // !YYDEBUG
 
@@ -159,89 +160,50 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 9 "parser.y" // lalr1.cc:479
+#line 9 "parser.y"
 namespace sqf { namespace parser { namespace config { namespace bison  {
-#line 165 "parser.tab.cc" // lalr1.cc:479
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 166 "parser.tab.cc"
 
   /// Build a parser object.
-  parser::parser (::sqf::parser::config::tokenizer &tokenizer_yyarg, ::sqf::parser::config::bison::astnode& result_yyarg, ::sqf::parser::config::parser& actual_yyarg)
-    :
+  parser::parser (::sqf::parser::config::tokenizer &tokenizer_yyarg, ::sqf::parser::config::builder& builder_yyarg, ::sqf::parser::config::parser& actual_yyarg)
 #if YYDEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       tokenizer (tokenizer_yyarg),
-      result (result_yyarg),
+      builder (builder_yyarg),
       actual (actual_yyarg)
   {}
 
   parser::~parser ()
   {}
 
+  parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  inline
-  parser::by_state::by_state ()
+  parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  inline
-  parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
-  inline
   void
-  parser::by_state::clear ()
+  parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
 
-  inline
   void
   parser::by_state::move (by_state& that)
   {
@@ -249,73 +211,116 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
     that.clear ();
   }
 
-  inline
-  parser::by_state::by_state (state_type s)
+  parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  inline
-  parser::symbol_number_type
-  parser::by_state::type_get () const
+  parser::symbol_kind_type
+  parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
-  inline
   parser::stack_symbol_type::stack_symbol_type ()
   {}
 
+  parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_classhead: // classhead
+      case symbol_kind::S_deleteclass: // deleteclass
+      case symbol_kind::S_field: // field
+      case symbol_kind::S_ident: // ident
+      case symbol_kind::S_string: // string
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_array: // array
+      case symbol_kind::S_arrayvalue: // arrayvalue
+      case symbol_kind::S_arrayvaluelist: // arrayvaluelist
+      case symbol_kind::S_anyval: // anyval
+      case symbol_kind::S_anyarr: // anyarr
+      case symbol_kind::S_anyp: // anyp
+      case symbol_kind::S_anyarray: // anyarray
+      case symbol_kind::S_anyvalue: // anyvalue
+        value.YY_MOVE_OR_COPY< ::sqf::parser::config::bison::astnode > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_DELETE: // "delete"
+      case symbol_kind::S_CLASS: // "class"
+      case symbol_kind::S_CURLYO: // "{"
+      case symbol_kind::S_CURLYC: // "}"
+      case symbol_kind::S_ROUNDO: // "("
+      case symbol_kind::S_ROUNDC: // ")"
+      case symbol_kind::S_SQUAREO: // "["
+      case symbol_kind::S_SQUAREC: // "]"
+      case symbol_kind::S_COLON: // ":"
+      case symbol_kind::S_SEMICOLON: // ";"
+      case symbol_kind::S_COMMA: // ","
+      case symbol_kind::S_PLUSEQUAL: // "+="
+      case symbol_kind::S_EQUAL: // "="
+      case symbol_kind::S_IDENT: // IDENT
+      case symbol_kind::S_NUMBER: // NUMBER
+      case symbol_kind::S_HEXNUMBER: // HEXNUMBER
+      case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_ANY: // ANY
+        value.YY_MOVE_OR_COPY< tokenizer::token > (YY_MOVE (that.value));
+        break;
 
-  inline
-  parser::stack_symbol_type::stack_symbol_type (state_type s, symbol_type& that)
-    : super_type (s, that.location)
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
+
+  parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
   {
-      switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 25: // topstatements
-      case 26: // topstatement
-      case 27: // statements
-      case 28: // statement
-      case 29: // classdef
-      case 30: // deleteclass
-      case 31: // classbody
-      case 32: // field
-      case 33: // ident
-      case 34: // string
-      case 35: // number
-      case 36: // array
-      case 37: // arrayvalue
-      case 38: // arrayvaluelist
-      case 39: // anyval
-      case 40: // anyarr
-      case 41: // anyp
-      case 42: // anyarray
-      case 43: // anyvalue
-        value.move< ::sqf::parser::config::bison::astnode > (that.value);
+      case symbol_kind::S_classhead: // classhead
+      case symbol_kind::S_deleteclass: // deleteclass
+      case symbol_kind::S_field: // field
+      case symbol_kind::S_ident: // ident
+      case symbol_kind::S_string: // string
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_array: // array
+      case symbol_kind::S_arrayvalue: // arrayvalue
+      case symbol_kind::S_arrayvaluelist: // arrayvaluelist
+      case symbol_kind::S_anyval: // anyval
+      case symbol_kind::S_anyarr: // anyarr
+      case symbol_kind::S_anyp: // anyp
+      case symbol_kind::S_anyarray: // anyarray
+      case symbol_kind::S_anyvalue: // anyvalue
+        value.move< ::sqf::parser::config::bison::astnode > (YY_MOVE (that.value));
         break;
 
-      case 4: // "delete"
-      case 5: // "class"
-      case 6: // "{"
-      case 7: // "}"
-      case 8: // "("
-      case 9: // ")"
-      case 10: // "["
-      case 11: // "]"
-      case 12: // ":"
-      case 13: // ";"
-      case 14: // ","
-      case 15: // "+="
-      case 16: // "="
-      case 17: // IDENT
-      case 18: // NUMBER
-      case 19: // HEXNUMBER
-      case 20: // STRING
-      case 21: // ANY
-        value.move< tokenizer::token > (that.value);
+      case symbol_kind::S_DELETE: // "delete"
+      case symbol_kind::S_CLASS: // "class"
+      case symbol_kind::S_CURLYO: // "{"
+      case symbol_kind::S_CURLYC: // "}"
+      case symbol_kind::S_ROUNDO: // "("
+      case symbol_kind::S_ROUNDC: // ")"
+      case symbol_kind::S_SQUAREO: // "["
+      case symbol_kind::S_SQUAREC: // "]"
+      case symbol_kind::S_COLON: // ":"
+      case symbol_kind::S_SEMICOLON: // ";"
+      case symbol_kind::S_COMMA: // ","
+      case symbol_kind::S_PLUSEQUAL: // "+="
+      case symbol_kind::S_EQUAL: // "="
+      case symbol_kind::S_IDENT: // IDENT
+      case symbol_kind::S_NUMBER: // NUMBER
+      case symbol_kind::S_HEXNUMBER: // HEXNUMBER
+      case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_ANY: // ANY
+        value.move< tokenizer::token > (YY_MOVE (that.value));
         break;
 
       default:
@@ -323,56 +328,51 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
-  inline
+#if YY_CPLUSPLUS < 201103L
   parser::stack_symbol_type&
   parser::stack_symbol_type::operator= (const stack_symbol_type& that)
   {
     state = that.state;
-      switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 25: // topstatements
-      case 26: // topstatement
-      case 27: // statements
-      case 28: // statement
-      case 29: // classdef
-      case 30: // deleteclass
-      case 31: // classbody
-      case 32: // field
-      case 33: // ident
-      case 34: // string
-      case 35: // number
-      case 36: // array
-      case 37: // arrayvalue
-      case 38: // arrayvaluelist
-      case 39: // anyval
-      case 40: // anyarr
-      case 41: // anyp
-      case 42: // anyarray
-      case 43: // anyvalue
+      case symbol_kind::S_classhead: // classhead
+      case symbol_kind::S_deleteclass: // deleteclass
+      case symbol_kind::S_field: // field
+      case symbol_kind::S_ident: // ident
+      case symbol_kind::S_string: // string
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_array: // array
+      case symbol_kind::S_arrayvalue: // arrayvalue
+      case symbol_kind::S_arrayvaluelist: // arrayvaluelist
+      case symbol_kind::S_anyval: // anyval
+      case symbol_kind::S_anyarr: // anyarr
+      case symbol_kind::S_anyp: // anyp
+      case symbol_kind::S_anyarray: // anyarray
+      case symbol_kind::S_anyvalue: // anyvalue
         value.copy< ::sqf::parser::config::bison::astnode > (that.value);
         break;
 
-      case 4: // "delete"
-      case 5: // "class"
-      case 6: // "{"
-      case 7: // "}"
-      case 8: // "("
-      case 9: // ")"
-      case 10: // "["
-      case 11: // "]"
-      case 12: // ":"
-      case 13: // ";"
-      case 14: // ","
-      case 15: // "+="
-      case 16: // "="
-      case 17: // IDENT
-      case 18: // NUMBER
-      case 19: // HEXNUMBER
-      case 20: // STRING
-      case 21: // ANY
+      case symbol_kind::S_DELETE: // "delete"
+      case symbol_kind::S_CLASS: // "class"
+      case symbol_kind::S_CURLYO: // "{"
+      case symbol_kind::S_CURLYC: // "}"
+      case symbol_kind::S_ROUNDO: // "("
+      case symbol_kind::S_ROUNDC: // ")"
+      case symbol_kind::S_SQUAREO: // "["
+      case symbol_kind::S_SQUAREC: // "]"
+      case symbol_kind::S_COLON: // ":"
+      case symbol_kind::S_SEMICOLON: // ";"
+      case symbol_kind::S_COMMA: // ","
+      case symbol_kind::S_PLUSEQUAL: // "+="
+      case symbol_kind::S_EQUAL: // "="
+      case symbol_kind::S_IDENT: // IDENT
+      case symbol_kind::S_NUMBER: // NUMBER
+      case symbol_kind::S_HEXNUMBER: // HEXNUMBER
+      case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_ANY: // ANY
         value.copy< tokenizer::token > (that.value);
         break;
 
@@ -384,9 +384,62 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
     return *this;
   }
 
+  parser::stack_symbol_type&
+  parser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_classhead: // classhead
+      case symbol_kind::S_deleteclass: // deleteclass
+      case symbol_kind::S_field: // field
+      case symbol_kind::S_ident: // ident
+      case symbol_kind::S_string: // string
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_array: // array
+      case symbol_kind::S_arrayvalue: // arrayvalue
+      case symbol_kind::S_arrayvaluelist: // arrayvaluelist
+      case symbol_kind::S_anyval: // anyval
+      case symbol_kind::S_anyarr: // anyarr
+      case symbol_kind::S_anyp: // anyp
+      case symbol_kind::S_anyarray: // anyarray
+      case symbol_kind::S_anyvalue: // anyvalue
+        value.move< ::sqf::parser::config::bison::astnode > (that.value);
+        break;
+
+      case symbol_kind::S_DELETE: // "delete"
+      case symbol_kind::S_CLASS: // "class"
+      case symbol_kind::S_CURLYO: // "{"
+      case symbol_kind::S_CURLYC: // "}"
+      case symbol_kind::S_ROUNDO: // "("
+      case symbol_kind::S_ROUNDC: // ")"
+      case symbol_kind::S_SQUAREO: // "["
+      case symbol_kind::S_SQUAREC: // "]"
+      case symbol_kind::S_COLON: // ":"
+      case symbol_kind::S_SEMICOLON: // ";"
+      case symbol_kind::S_COMMA: // ","
+      case symbol_kind::S_PLUSEQUAL: // "+="
+      case symbol_kind::S_EQUAL: // "="
+      case symbol_kind::S_IDENT: // IDENT
+      case symbol_kind::S_NUMBER: // NUMBER
+      case symbol_kind::S_HEXNUMBER: // HEXNUMBER
+      case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_ANY: // ANY
+        value.move< tokenizer::token > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
 
   template <typename Base>
-  inline
   void
   parser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
   {
@@ -397,44 +450,45 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
 #if YYDEBUG
   template <typename Base>
   void
-  parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    YYUSE (yytype);
-    yyo << ')';
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        YY_USE (yykind);
+        yyo << ')';
+      }
   }
 #endif
 
-  inline
   void
-  parser::yypush_ (const char* m, state_type s, symbol_type& sym)
+  parser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
   {
-    stack_symbol_type t (s, sym);
-    yypush_ (m, t);
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
   }
 
-  inline
   void
-  parser::yypush_ (const char* m, stack_symbol_type& s)
+  parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
   {
-    if (m)
-      YY_SYMBOL_PRINT (m, s);
-    yystack_.push (s);
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
   }
 
-  inline
   void
-  parser::yypop_ (unsigned int n)
+  parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -466,32 +520,37 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
   }
 #endif // YYDEBUG
 
-  inline parser::state_type
+  parser::state_type
   parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
-  inline bool
-  parser::yy_pact_value_is_default_ (int yyvalue)
+  bool
+  parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
-  inline bool
-  parser::yy_table_value_is_error_ (int yyvalue)
+  bool
+  parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
 
+  int
+  parser::operator() ()
+  {
+    return parse ();
+  }
+
   int
   parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -509,11 +568,11 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
     /// The return value of parse ().
     int yyresult;
 
-    // FIXME: This shoud be completely indented.  It is not yet to
-    // avoid gratuitous conflicts when merging into the master branch.
+#if YY_EXCEPTIONS
     try
+#endif // YY_EXCEPTIONS
       {
-    YYCDEBUG << "Starting parse" << std::endl;
+    YYCDEBUG << "Starting parse\n";
 
 
     /* Initialize the stack.  The initial state will be set in
@@ -521,48 +580,70 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
        location values to have been already stored, initialize these
        stacks with a primary value.  */
     yystack_.clear ();
-    yypush_ (YY_NULLPTR, 0, yyla);
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << std::endl;
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
-  yybackup:
 
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
         try
+#endif // YY_EXCEPTIONS
           {
             symbol_type yylookahead (yylex (tokenizer));
             yyla.move (yylookahead);
           }
+#if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
+#endif // YY_EXCEPTIONS
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -579,72 +660,69 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, yyla);
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
     {
       stack_symbol_type yylhs;
-      yylhs.state = yy_lr_goto_state_(yystack_[yylen].state, yyr1_[yyn]);
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
       /* Variants are always initialized to an empty instance of the
          correct type. The default '$$ = $1' action is NOT applied
          when using variants.  */
-        switch (yyr1_[yyn])
+      switch (yyr1_[yyn])
     {
-      case 25: // topstatements
-      case 26: // topstatement
-      case 27: // statements
-      case 28: // statement
-      case 29: // classdef
-      case 30: // deleteclass
-      case 31: // classbody
-      case 32: // field
-      case 33: // ident
-      case 34: // string
-      case 35: // number
-      case 36: // array
-      case 37: // arrayvalue
-      case 38: // arrayvaluelist
-      case 39: // anyval
-      case 40: // anyarr
-      case 41: // anyp
-      case 42: // anyarray
-      case 43: // anyvalue
-        yylhs.value.build< ::sqf::parser::config::bison::astnode > ();
+      case symbol_kind::S_classhead: // classhead
+      case symbol_kind::S_deleteclass: // deleteclass
+      case symbol_kind::S_field: // field
+      case symbol_kind::S_ident: // ident
+      case symbol_kind::S_string: // string
+      case symbol_kind::S_number: // number
+      case symbol_kind::S_array: // array
+      case symbol_kind::S_arrayvalue: // arrayvalue
+      case symbol_kind::S_arrayvaluelist: // arrayvaluelist
+      case symbol_kind::S_anyval: // anyval
+      case symbol_kind::S_anyarr: // anyarr
+      case symbol_kind::S_anyp: // anyp
+      case symbol_kind::S_anyarray: // anyarray
+      case symbol_kind::S_anyvalue: // anyvalue
+        yylhs.value.emplace< ::sqf::parser::config::bison::astnode > ();
         break;
 
-      case 4: // "delete"
-      case 5: // "class"
-      case 6: // "{"
-      case 7: // "}"
-      case 8: // "("
-      case 9: // ")"
-      case 10: // "["
-      case 11: // "]"
-      case 12: // ":"
-      case 13: // ";"
-      case 14: // ","
-      case 15: // "+="
-      case 16: // "="
-      case 17: // IDENT
-      case 18: // NUMBER
-      case 19: // HEXNUMBER
-      case 20: // STRING
-      case 21: // ANY
-        yylhs.value.build< tokenizer::token > ();
+      case symbol_kind::S_DELETE: // "delete"
+      case symbol_kind::S_CLASS: // "class"
+      case symbol_kind::S_CURLYO: // "{"
+      case symbol_kind::S_CURLYC: // "}"
+      case symbol_kind::S_ROUNDO: // "("
+      case symbol_kind::S_ROUNDC: // ")"
+      case symbol_kind::S_SQUAREO: // "["
+      case symbol_kind::S_SQUAREC: // "]"
+      case symbol_kind::S_COLON: // ":"
+      case symbol_kind::S_SEMICOLON: // ";"
+      case symbol_kind::S_COMMA: // ","
+      case symbol_kind::S_PLUSEQUAL: // "+="
+      case symbol_kind::S_EQUAL: // "="
+      case symbol_kind::S_IDENT: // IDENT
+      case symbol_kind::S_NUMBER: // NUMBER
+      case symbol_kind::S_HEXNUMBER: // HEXNUMBER
+      case symbol_kind::S_STRING: // STRING
+      case symbol_kind::S_ANY: // ANY
+        yylhs.value.emplace< tokenizer::token > ();
         break;
 
       default:
@@ -652,383 +730,312 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
     }
 
 
-      // Compute the default @$.
+      // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
       }
 
       // Perform the reduction.
       YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
       try
+#endif // YY_EXCEPTIONS
         {
           switch (yyn)
             {
-  case 2:
-#line 157 "parser.y" // lalr1.cc:859
-    { result = ::sqf::parser::config::bison::astnode{}; }
-#line 671 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 3:
-#line 158 "parser.y" // lalr1.cc:859
-    { result = ::sqf::parser::config::bison::astnode{}; result.append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 677 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 4:
-#line 159 "parser.y" // lalr1.cc:859
-    { result = ::sqf::parser::config::bison::astnode{}; }
-#line 683 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 5:
-#line 160 "parser.y" // lalr1.cc:859
-    { result = ::sqf::parser::config::bison::astnode{}; result.append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 689 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 8:
-#line 165 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::STATEMENTS }; yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 695 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 9:
-#line 166 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[1].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 701 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 10:
-#line 167 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[2].value.as< ::sqf::parser::config::bison::astnode > (); yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 707 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 11:
-#line 169 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 713 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 12:
-#line 170 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 719 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 13:
-#line 172 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::STATEMENTS }; yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 725 "parser.tab.cc" // lalr1.cc:859
+  case 12: // topstatement: deleteclass
+#line 169 "parser.y"
+                                                        { builder.apply(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ()); }
+#line 752 "parser.tab.cc"
     break;
 
-  case 14:
-#line 173 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[1].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 731 "parser.tab.cc" // lalr1.cc:859
+  case 17: // statement: field
+#line 176 "parser.y"
+                                                        { builder.apply(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ()); }
+#line 758 "parser.tab.cc"
     break;
 
-  case 15:
-#line 174 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[2].value.as< ::sqf::parser::config::bison::astnode > (); yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 737 "parser.tab.cc" // lalr1.cc:859
+  case 18: // statement: deleteclass
+#line 177 "parser.y"
+                                                        { builder.apply(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ()); }
+#line 764 "parser.tab.cc"
     break;
 
-  case 16:
-#line 176 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 743 "parser.tab.cc" // lalr1.cc:859
+  case 19: // classdef: classhead
+#line 180 "parser.y"
+                                                        { builder.apply(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ()); }
+#line 770 "parser.tab.cc"
     break;
 
-  case 17:
-#line 177 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 749 "parser.tab.cc" // lalr1.cc:859
+  case 20: // $@1: %empty
+#line 181 "parser.y"
+                                                        { builder.open(yystack_[1].value.as < ::sqf::parser::config::bison::astnode > ()); }
+#line 776 "parser.tab.cc"
     break;
 
-  case 18:
-#line 178 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 755 "parser.tab.cc" // lalr1.cc:859
+  case 21: // classdef: classhead "{" $@1 classbody
+#line 182 "parser.y"
+                                                        { builder.close(); }
+#line 782 "parser.tab.cc"
     break;
 
-  case 19:
-#line 181 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::CLASS_DEF, yystack_[1].value.as< tokenizer::token > () }; yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 761 "parser.tab.cc" // lalr1.cc:859
+  case 22: // classhead: "class" ident
+#line 184 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::CLASS_DEF, yystack_[1].value.as < tokenizer::token > () }; yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ())); }
+#line 788 "parser.tab.cc"
     break;
 
-  case 20:
-#line 182 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::CLASS_DEF_EXT, yystack_[3].value.as< tokenizer::token > () }; yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[2].value.as< ::sqf::parser::config::bison::astnode > ()); yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 767 "parser.tab.cc" // lalr1.cc:859
+  case 23: // classhead: "class" ident ":" ident
+#line 185 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::CLASS_DEF_EXT, yystack_[3].value.as < tokenizer::token > () }; yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[2].value.as < ::sqf::parser::config::bison::astnode > ())); yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ())); }
+#line 794 "parser.tab.cc"
     break;
 
-  case 21:
-#line 183 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::CLASS, yystack_[2].value.as< tokenizer::token > () }; yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[1].value.as< ::sqf::parser::config::bison::astnode > ()); yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 773 "parser.tab.cc" // lalr1.cc:859
+  case 24: // deleteclass: "delete" ident
+#line 187 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::DELETE_CLASS, yystack_[1].value.as < tokenizer::token > () }; yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ())); }
+#line 800 "parser.tab.cc"
     break;
 
-  case 22:
-#line 184 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::CLASS_EXT, yystack_[4].value.as< tokenizer::token > () }; yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[3].value.as< ::sqf::parser::config::bison::astnode > ()); yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[1].value.as< ::sqf::parser::config::bison::astnode > ()); yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 779 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 23:
-#line 186 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::DELETE_CLASS, yystack_[1].value.as< tokenizer::token > () }; yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 785 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 24:
-#line 189 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::STATEMENTS }; }
-#line 791 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 25:
-#line 190 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[1].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 797 "parser.tab.cc" // lalr1.cc:859
-    break;
-
-  case 26:
-#line 194 "parser.y" // lalr1.cc:859
-    {
-         yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::FIELD, yystack_[1].value.as< tokenizer::token > () };
-         yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[2].value.as< ::sqf::parser::config::bison::astnode > ());
-         if (yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ().children.size() == 1 && yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ().children[0].kind != astkind::ANY)
+  case 27: // field: ident "=" anyvalue
+#line 195 "parser.y"
+     {
+         yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::FIELD, yystack_[1].value.as < tokenizer::token > () };
+         yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[2].value.as < ::sqf::parser::config::bison::astnode > ()));
+         if (yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ().children.size() == 1 && yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ().children[0].kind != astkind::ANY)
          {
-            yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ().children[0]);
+            yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ().children[0]));
          }
          else
          {
-            yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ());
+            yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ()));
          }
      }
-#line 814 "parser.tab.cc" // lalr1.cc:859
+#line 817 "parser.tab.cc"
     break;
 
-  case 27:
-#line 206 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::FIELD_ARRAY, yystack_[1].value.as< tokenizer::token > () }; yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[4].value.as< ::sqf::parser::config::bison::astnode > ()); yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 820 "parser.tab.cc" // lalr1.cc:859
+  case 28: // field: ident "[" "]" "=" array
+#line 207 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::FIELD_ARRAY, yystack_[1].value.as < tokenizer::token > () }; yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[4].value.as < ::sqf::parser::config::bison::astnode > ())); yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ())); }
+#line 823 "parser.tab.cc"
     break;
 
-  case 28:
-#line 207 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::FIELD_ARRAY_APPEND, yystack_[1].value.as< tokenizer::token > () }; yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[4].value.as< ::sqf::parser::config::bison::astnode > ()); yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 826 "parser.tab.cc" // lalr1.cc:859
+  case 29: // field: ident "[" "]" "+=" array
+#line 208 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::FIELD_ARRAY_APPEND, yystack_[1].value.as < tokenizer::token > () }; yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[4].value.as < ::sqf::parser::config::bison::astnode > ())); yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ())); }
+#line 829 "parser.tab.cc"
     break;
 
-  case 29:
-#line 210 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::IDENT, yystack_[0].value.as< tokenizer::token > () }; }
-#line 832 "parser.tab.cc" // lalr1.cc:859
+  case 30: // ident: IDENT
+#line 211 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::IDENT, yystack_[0].value.as < tokenizer::token > () }; }
+#line 835 "parser.tab.cc"
     break;
 
-  case 30:
-#line 212 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::STRING, yystack_[0].value.as< tokenizer::token > () }; }
-#line 838 "parser.tab.cc" // lalr1.cc:859
+  case 31: // string: STRING
+#line 213 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::STRING, yystack_[0].value.as < tokenizer::token > () }; }
+#line 841 "parser.tab.cc"
     break;
 
-  case 31:
-#line 214 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::NUMBER_DECIMAL, yystack_[0].value.as< tokenizer::token > () }; }
-#line 844 "parser.tab.cc" // lalr1.cc:859
+  case 32: // number: NUMBER
+#line 215 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::NUMBER_DECIMAL, yystack_[0].value.as < tokenizer::token > () }; }
+#line 847 "parser.tab.cc"
     break;
 
-  case 32:
-#line 215 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::NUMBER_HEXADECIMAL, yystack_[0].value.as< tokenizer::token > () }; }
-#line 850 "parser.tab.cc" // lalr1.cc:859
+  case 33: // number: HEXNUMBER
+#line 216 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::NUMBER_HEXADECIMAL, yystack_[0].value.as < tokenizer::token > () }; }
+#line 853 "parser.tab.cc"
     break;
 
-  case 33:
-#line 217 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ARRAY }; }
-#line 856 "parser.tab.cc" // lalr1.cc:859
+  case 34: // array: "{" "}"
+#line 218 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ARRAY }; }
+#line 859 "parser.tab.cc"
     break;
 
-  case 34:
-#line 218 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[1].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 862 "parser.tab.cc" // lalr1.cc:859
+  case 35: // array: "{" arrayvaluelist "}"
+#line 219 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = std::move(yystack_[1].value.as < ::sqf::parser::config::bison::astnode > ()); }
+#line 865 "parser.tab.cc"
     break;
 
-  case 35:
-#line 220 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 868 "parser.tab.cc" // lalr1.cc:859
+  case 36: // arrayvalue: array
+#line 221 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ()); }
+#line 871 "parser.tab.cc"
     break;
 
-  case 36:
-#line 222 "parser.y" // lalr1.cc:859
-    {
-              if (yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ().children.size() == 1 && yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ().children[0].kind != astkind::ANY)
+  case 37: // arrayvalue: anyarray
+#line 223 "parser.y"
+          {
+              if (yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ().children.size() == 1 && yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ().children[0].kind != astkind::ANY)
               {
-                 yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ().children[0];
+                 yylhs.value.as < ::sqf::parser::config::bison::astnode > () = std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ().children[0]);
               }
               else
               {
-                 yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ();
+                 yylhs.value.as < ::sqf::parser::config::bison::astnode > () = std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ());
               }
           }
-#line 883 "parser.tab.cc" // lalr1.cc:859
+#line 886 "parser.tab.cc"
     break;
 
-  case 37:
-#line 233 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ARRAY }; yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 889 "parser.tab.cc" // lalr1.cc:859
+  case 38: // arrayvaluelist: arrayvalue
+#line 234 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ARRAY }; yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ())); }
+#line 892 "parser.tab.cc"
     break;
 
-  case 38:
-#line 234 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[2].value.as< ::sqf::parser::config::bison::astnode > (); yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 895 "parser.tab.cc" // lalr1.cc:859
+  case 39: // arrayvaluelist: arrayvaluelist "," arrayvalue
+#line 235 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = std::move(yystack_[2].value.as < ::sqf::parser::config::bison::astnode > ()); yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ())); }
+#line 898 "parser.tab.cc"
     break;
 
-  case 39:
-#line 236 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 901 "parser.tab.cc" // lalr1.cc:859
+  case 40: // anyval: anyp
+#line 237 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ()); }
+#line 904 "parser.tab.cc"
     break;
 
-  case 40:
-#line 237 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as< tokenizer::token > () }; }
-#line 907 "parser.tab.cc" // lalr1.cc:859
+  case 41: // anyval: "{"
+#line 238 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as < tokenizer::token > () }; }
+#line 910 "parser.tab.cc"
     break;
 
-  case 41:
-#line 238 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as< tokenizer::token > () }; }
-#line 913 "parser.tab.cc" // lalr1.cc:859
+  case 42: // anyval: "}"
+#line 239 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as < tokenizer::token > () }; }
+#line 916 "parser.tab.cc"
     break;
 
-  case 42:
-#line 239 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as< tokenizer::token > () }; }
-#line 919 "parser.tab.cc" // lalr1.cc:859
+  case 43: // anyval: ","
+#line 240 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as < tokenizer::token > () }; }
+#line 922 "parser.tab.cc"
     break;
 
-  case 43:
-#line 241 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 925 "parser.tab.cc" // lalr1.cc:859
+  case 44: // anyarr: anyp
+#line 242 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ()); }
+#line 928 "parser.tab.cc"
     break;
 
-  case 44:
-#line 243 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as< tokenizer::token > () }; }
-#line 931 "parser.tab.cc" // lalr1.cc:859
+  case 45: // anyp: "class"
+#line 244 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as < tokenizer::token > () }; }
+#line 934 "parser.tab.cc"
     break;
 
-  case 45:
-#line 244 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as< tokenizer::token > () }; }
-#line 937 "parser.tab.cc" // lalr1.cc:859
+  case 46: // anyp: "delete"
+#line 245 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as < tokenizer::token > () }; }
+#line 940 "parser.tab.cc"
     break;
 
-  case 46:
-#line 245 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 943 "parser.tab.cc" // lalr1.cc:859
+  case 47: // anyp: number
+#line 246 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ()); }
+#line 946 "parser.tab.cc"
     break;
 
-  case 47:
-#line 246 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 949 "parser.tab.cc" // lalr1.cc:859
+  case 48: // anyp: string
+#line 247 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ()); }
+#line 952 "parser.tab.cc"
     break;
 
-  case 48:
-#line 247 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[0].value.as< ::sqf::parser::config::bison::astnode > (); }
-#line 955 "parser.tab.cc" // lalr1.cc:859
+  case 49: // anyp: ident
+#line 248 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ()); }
+#line 958 "parser.tab.cc"
     break;
 
-  case 49:
-#line 248 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as< tokenizer::token > () }; }
-#line 961 "parser.tab.cc" // lalr1.cc:859
+  case 50: // anyp: "["
+#line 249 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as < tokenizer::token > () }; }
+#line 964 "parser.tab.cc"
     break;
 
-  case 50:
-#line 249 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as< tokenizer::token > () }; }
-#line 967 "parser.tab.cc" // lalr1.cc:859
+  case 51: // anyp: "]"
+#line 250 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as < tokenizer::token > () }; }
+#line 970 "parser.tab.cc"
     break;
 
-  case 51:
-#line 250 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as< tokenizer::token > () }; }
-#line 973 "parser.tab.cc" // lalr1.cc:859
+  case 52: // anyp: ":"
+#line 251 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as < tokenizer::token > () }; }
+#line 976 "parser.tab.cc"
     break;
 
-  case 52:
-#line 251 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as< tokenizer::token > () }; }
-#line 979 "parser.tab.cc" // lalr1.cc:859
+  case 53: // anyp: "="
+#line 252 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as < tokenizer::token > () }; }
+#line 982 "parser.tab.cc"
     break;
 
-  case 53:
-#line 252 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as< tokenizer::token > () }; }
-#line 985 "parser.tab.cc" // lalr1.cc:859
+  case 54: // anyp: ANY
+#line 253 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANY, yystack_[0].value.as < tokenizer::token > () }; }
+#line 988 "parser.tab.cc"
     break;
 
-  case 54:
-#line 254 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANYSTRING }; yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 991 "parser.tab.cc" // lalr1.cc:859
+  case 55: // anyarray: anyarr
+#line 255 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANYSTRING }; yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ())); }
+#line 994 "parser.tab.cc"
     break;
 
-  case 55:
-#line 255 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[1].value.as< ::sqf::parser::config::bison::astnode > (); yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 997 "parser.tab.cc" // lalr1.cc:859
+  case 56: // anyarray: anyarray anyarr
+#line 256 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = std::move(yystack_[1].value.as < ::sqf::parser::config::bison::astnode > ()); yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ())); }
+#line 1000 "parser.tab.cc"
     break;
 
-  case 56:
-#line 257 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANYSTRING }; yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 1003 "parser.tab.cc" // lalr1.cc:859
+  case 57: // anyvalue: anyval
+#line 258 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = ::sqf::parser::config::bison::astnode{ astkind::ANYSTRING }; yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ())); }
+#line 1006 "parser.tab.cc"
     break;
 
-  case 57:
-#line 258 "parser.y" // lalr1.cc:859
-    { yylhs.value.as< ::sqf::parser::config::bison::astnode > () = yystack_[1].value.as< ::sqf::parser::config::bison::astnode > (); yylhs.value.as< ::sqf::parser::config::bison::astnode > ().append(yystack_[0].value.as< ::sqf::parser::config::bison::astnode > ()); }
-#line 1009 "parser.tab.cc" // lalr1.cc:859
+  case 58: // anyvalue: anyvalue anyval
+#line 259 "parser.y"
+                                                        { yylhs.value.as < ::sqf::parser::config::bison::astnode > () = std::move(yystack_[1].value.as < ::sqf::parser::config::bison::astnode > ()); yylhs.value.as < ::sqf::parser::config::bison::astnode > ().append(std::move(yystack_[0].value.as < ::sqf::parser::config::bison::astnode > ())); }
+#line 1012 "parser.tab.cc"
     break;
 
 
-#line 1013 "parser.tab.cc" // lalr1.cc:859
+#line 1016 "parser.tab.cc"
+
             default:
               break;
             }
         }
+#if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
+#endif // YY_EXCEPTIONS
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
-      yypush_ (YY_NULLPTR, yylhs);
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -1037,7 +1044,9 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1048,7 +1057,7 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1065,69 +1074,81 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
-    yyerror_range[1].location = yystack_[yylen - 1].location;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
-      yypush_ ("Shifting", error_token);
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -1135,6 +1156,7 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1143,12 +1165,12 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
 
     return yyresult;
   }
+#if YY_EXCEPTIONS
     catch (...)
       {
-        YYCDEBUG << "Exception caught: cleaning lookahead and stack"
-                 << std::endl;
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
         // Do not try to display the values of the reclaimed symbols,
-        // as their printer might throw an exception.
+        // as their printers might throw an exception.
         if (!yyla.empty ())
           yy_destroy_ (YY_NULLPTR, yyla);
 
@@ -1159,26 +1181,112 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
           }
         throw;
       }
+#endif // YY_EXCEPTIONS
   }
 
   void
   parser::error (const syntax_error& yyexc)
   {
-    error (yyexc.location, yyexc.what());
+    error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
 
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // parser::context.
+  parser::context::context (const parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -1197,41 +1305,32 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -1240,22 +1339,23 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
         case N:                               \
           yyformat = S;                       \
         break
-        YYCASE_(0, YY_("syntax error"));
-        YYCASE_(1, YY_("syntax error, unexpected %s"));
-        YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-        YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-        YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-        YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+      default: // Avoid compiler warnings.
+        YYCASE_ (0, YY_("syntax error"));
+        YYCASE_ (1, YY_("syntax error, unexpected %s"));
+        YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
+        YYCASE_ (3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+        YYCASE_ (4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+        YYCASE_ (5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
 #undef YYCASE_
       }
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -1264,170 +1364,170 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
   }
 
 
-  const signed char parser::yypact_ninf_ = -30;
+  const signed char parser::yypact_ninf_ = -33;
 
   const signed char parser::yytable_ninf_ = -1;
 
   const signed char
   parser::yypact_[] =
   {
-      71,   -30,   -14,   -14,   -30,    11,    64,    22,   -30,   -30,
-     -30,   -30,   -30,     0,   -30,   -30,    22,    64,    81,   -14,
-     -30,   -30,   -30,    45,   -30,   -30,   -30,   -30,    41,    33,
-     -30,    86,    42,    26,   -30,   -30,    77,   -30,   -30,   -30,
-     -30,   -30,   -30,   -30,   -30,   -30,   -30,   -30,   -30,   -30,
-     -30,   -30,   -30,   -30,   -30,    26,    53,    53,   -30,     3,
-     -30,   -30,   -30,   -30,   -30,    20,   -30,   -30,    62,   -30,
-      44,   -30,   -30
+       4,   -33,     9,     9,   -33,    15,    17,    23,   -33,   -33,
+      37,   -33,   -33,   -33,    61,   -33,   -33,    23,    17,   -33,
+       9,   -33,     6,   -33,   -33,    47,   -33,   -33,   -33,   -33,
+     -33,    45,   -33,    24,    48,    28,   -33,    -9,   -33,   -33,
+     -33,   -33,   -33,   -33,   -33,   -33,   -33,   -33,   -33,   -33,
+     -33,   -33,   -33,   -33,   -33,   -33,    28,    71,    71,   -33,
+      46,   -33,   -33,   -33,   -33,   -33,     5,   -33,   -33,    82,
+     -33,    64,   -33,   -33
   };
 
-  const unsigned char
+  const signed char
   parser::yydefact_[] =
   {
        0,     2,     0,     0,     6,     0,     4,     3,     8,    11,
-      12,    29,    23,    19,     1,     7,     5,     9,     0,     0,
-      21,    10,    24,     0,    13,    16,    18,    17,     0,    20,
-      25,    14,     0,     0,    22,    15,     0,    45,    44,    40,
-      41,    49,    50,    51,    42,    52,    31,    32,    30,    53,
-      48,    47,    46,    56,    39,    26,     0,     0,    57,     0,
-      28,    27,    33,    35,    37,     0,    54,    43,    36,    34,
-       0,    55,    38
+      19,    12,    30,    24,    22,     1,     7,     5,     9,    20,
+       0,    10,     0,    23,    25,     0,    13,    16,    18,    21,
+      17,     0,    26,    14,     0,     0,    15,     0,    46,    45,
+      41,    42,    50,    51,    52,    43,    53,    32,    33,    31,
+      54,    49,    48,    47,    57,    40,    27,     0,     0,    58,
+       0,    29,    28,    34,    36,    38,     0,    55,    44,    37,
+      35,     0,    56,    39
   };
 
   const signed char
   parser::yypgoto_[] =
   {
-     -30,   -30,     2,    83,    70,   -30,    39,   -13,    10,    67,
-     -30,    -2,   -30,   -30,    38,    27,   -30,    46,    32,   -29,
-     -30,   -30
+     -33,   -33,     2,    72,    70,   -33,    56,   -17,   -33,   -33,
+      -8,   -33,   -33,    -2,   -33,   -33,    14,     8,   -33,    34,
+      22,   -32,   -33,   -33
   };
 
   const signed char
   parser::yydefgoto_[] =
   {
-      -1,     5,    17,     7,     8,    23,    24,     9,    10,    20,
-      27,    50,    51,    52,    63,    64,    65,    53,    66,    67,
-      68,    55
+       0,     5,    18,     7,     8,    25,    26,     9,    22,    10,
+      11,    29,    30,    51,    52,    53,    64,    65,    66,    54,
+      67,    68,    69,    56
   };
 
-  const unsigned char
+  const signed char
   parser::yytable_[] =
   {
-      12,    13,     6,    11,    54,    25,    18,    37,    38,    59,
-      62,    14,    19,    41,    42,    43,    28,    29,    25,    45,
-      11,    46,    47,    48,    49,    31,    54,    69,    26,    28,
-      37,    38,    39,    40,    70,     4,    41,    42,    43,    18,
-      44,    26,    45,    11,    46,    47,    48,    49,    37,    38,
-      59,    32,    30,    36,    41,    42,    43,    33,     4,    59,
-      45,    11,    46,    47,    48,    49,    37,    38,     2,     3,
-      35,     1,    41,    42,    43,     2,     3,    15,    45,    11,
-      46,    47,    48,    49,     4,     2,     3,    21,    22,    16,
-       2,     3,    56,    57,    60,    61,    34,    72,    11,    15,
-      71,    58,     0,    11
+      13,    14,     6,    55,     1,    27,    57,    58,     2,     3,
+       2,     3,    70,    24,    28,    15,    27,     4,    23,    71,
+      31,     2,     3,    12,    55,    28,    12,    33,     2,     3,
+      16,    31,    38,    39,    40,    41,     4,    16,    42,    43,
+      44,    12,    45,    19,    46,    12,    47,    48,    49,    50,
+      38,    39,    60,    63,    32,    34,    42,    43,    44,    37,
+       4,    35,    46,    12,    47,    48,    49,    50,    38,    39,
+      60,    61,    62,    20,    42,    43,    44,    60,    17,    73,
+      46,    12,    47,    48,    49,    50,    38,    39,    21,    36,
+      59,    72,    42,    43,    44,     0,     0,     0,    46,    12,
+      47,    48,    49,    50
   };
 
   const signed char
   parser::yycheck_[] =
   {
-       2,     3,     0,    17,    33,    18,     6,     4,     5,     6,
-       7,     0,    12,    10,    11,    12,    18,    19,    31,    16,
-      17,    18,    19,    20,    21,    23,    55,     7,    18,    31,
-       4,     5,     6,     7,    14,    13,    10,    11,    12,     6,
-      14,    31,    16,    17,    18,    19,    20,    21,     4,     5,
-       6,    10,     7,    11,    10,    11,    12,    16,    13,     6,
-      16,    17,    18,    19,    20,    21,     4,     5,     4,     5,
-      31,     0,    10,    11,    12,     4,     5,    13,    16,    17,
-      18,    19,    20,    21,    13,     4,     5,    17,     7,     6,
-       4,     5,    15,    16,    56,    57,    29,    70,    17,    13,
-      68,    55,    -1,    17
+       2,     3,     0,    35,     0,    22,    15,    16,     4,     5,
+       4,     5,     7,     7,    22,     0,    33,    13,    20,    14,
+      22,     4,     5,    17,    56,    33,    17,    25,     4,     5,
+      13,    33,     4,     5,     6,     7,    13,    13,    10,    11,
+      12,    17,    14,     6,    16,    17,    18,    19,    20,    21,
+       4,     5,     6,     7,     7,    10,    10,    11,    12,    11,
+      13,    16,    16,    17,    18,    19,    20,    21,     4,     5,
+       6,    57,    58,    12,    10,    11,    12,     6,     6,    71,
+      16,    17,    18,    19,    20,    21,     4,     5,    18,    33,
+      56,    69,    10,    11,    12,    -1,    -1,    -1,    16,    17,
+      18,    19,    20,    21
   };
 
-  const unsigned char
+  const signed char
   parser::yystos_[] =
   {
        0,     0,     4,     5,    13,    23,    24,    25,    26,    29,
-      30,    17,    33,    33,     0,    13,    25,    24,     6,    12,
-      31,    26,     7,    27,    28,    29,    30,    32,    33,    33,
-       7,    24,    10,    16,    31,    28,    11,     4,     5,     6,
-       7,    10,    11,    12,    14,    16,    18,    19,    20,    21,
-      33,    34,    35,    39,    41,    43,    15,    16,    39,     6,
-      36,    36,     7,    36,    37,    38,    40,    41,    42,     7,
-      14,    40,    37
+      31,    32,    17,    35,    35,     0,    13,    25,    24,     6,
+      12,    26,    30,    35,     7,    27,    28,    29,    32,    33,
+      34,    35,     7,    24,    10,    16,    28,    11,     4,     5,
+       6,     7,    10,    11,    12,    14,    16,    18,    19,    20,
+      21,    35,    36,    37,    41,    43,    45,    15,    16,    41,
+       6,    38,    38,     7,    38,    39,    40,    42,    43,    44,
+       7,    14,    42,    39
   };
 
-  const unsigned char
+  const signed char
   parser::yyr1_[] =
   {
        0,    22,    23,    23,    23,    23,    24,    24,    25,    25,
       25,    26,    26,    27,    27,    27,    28,    28,    28,    29,
-      29,    29,    29,    30,    31,    31,    32,    32,    32,    33,
-      34,    35,    35,    36,    36,    37,    37,    38,    38,    39,
-      39,    39,    39,    40,    41,    41,    41,    41,    41,    41,
-      41,    41,    41,    41,    42,    42,    43,    43
+      30,    29,    31,    31,    32,    33,    33,    34,    34,    34,
+      35,    36,    37,    37,    38,    38,    39,    39,    40,    40,
+      41,    41,    41,    41,    42,    43,    43,    43,    43,    43,
+      43,    43,    43,    43,    43,    44,    44,    45,    45
   };
 
-  const unsigned char
+  const signed char
   parser::yyr2_[] =
   {
        0,     2,     1,     1,     1,     2,     1,     2,     1,     2,
-       3,     1,     1,     1,     2,     3,     1,     1,     1,     2,
-       4,     3,     5,     2,     2,     3,     3,     5,     5,     1,
-       1,     1,     1,     2,     3,     1,     1,     1,     3,     1,
+       3,     1,     1,     1,     2,     3,     1,     1,     1,     1,
+       0,     4,     2,     4,     2,     1,     2,     3,     5,     5,
+       1,     1,     1,     1,     2,     3,     1,     1,     1,     3,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     2,     1,     2
+       1,     1,     1,     1,     1,     1,     2,     1,     2
   };
 
 
-
+#if YYDEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const parser::yytname_[] =
   {
-  "END_OF_FILE", "error", "$undefined", "INVALID", "\"delete\"",
+  "END_OF_FILE", "error", "\"invalid token\"", "INVALID", "\"delete\"",
   "\"class\"", "\"{\"", "\"}\"", "\"(\"", "\")\"", "\"[\"", "\"]\"",
   "\":\"", "\";\"", "\",\"", "\"+=\"", "\"=\"", "IDENT", "NUMBER",
   "HEXNUMBER", "STRING", "ANY", "$accept", "start", "separators",
   "topstatements", "topstatement", "statements", "statement", "classdef",
-  "deleteclass", "classbody", "field", "ident", "string", "number",
-  "array", "arrayvalue", "arrayvaluelist", "anyval", "anyarr", "anyp",
-  "anyarray", "anyvalue", YY_NULLPTR
+  "$@1", "classhead", "deleteclass", "classbody", "field", "ident",
+  "string", "number", "array", "arrayvalue", "arrayvaluelist", "anyval",
+  "anyarr", "anyp", "anyarray", "anyvalue", YY_NULLPTR
   };
+#endif
+
 
 #if YYDEBUG
-  const unsigned short int
+  const short
   parser::yyrline_[] =
   {
-       0,   157,   157,   158,   159,   160,   162,   163,   165,   166,
-     167,   169,   170,   172,   173,   174,   176,   177,   178,   181,
-     182,   183,   184,   186,   189,   190,   193,   206,   207,   210,
-     212,   214,   215,   217,   218,   220,   221,   233,   234,   236,
-     237,   238,   239,   241,   243,   244,   245,   246,   247,   248,
-     249,   250,   251,   252,   254,   255,   257,   258
+       0,   156,   156,   157,   158,   159,   161,   162,   164,   165,
+     166,   168,   169,   171,   172,   173,   175,   176,   177,   180,
+     181,   181,   184,   185,   187,   190,   191,   194,   207,   208,
+     211,   213,   215,   216,   218,   219,   221,   222,   234,   235,
+     237,   238,   239,   240,   242,   244,   245,   246,   247,   248,
+     249,   250,   251,   252,   253,   255,   256,   258,   259
   };
 
-  // Print the state stack on the debug stream.
   void
-  parser::yystack_print_ ()
+  parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
-    *yycdebug_ << std::endl;
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  parser::yy_reduce_print_ (int yyrule)
+  parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned int yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
-               << " (line " << yylno << "):" << std::endl;
+               << " (line " << yylno << "):\n";
     // The symbols being reduced.
     for (int yyi = 0; yyi < yynrhs; yyi++)
       YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
@@ -1436,10 +1536,11 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
 #endif // YYDEBUG
 
 
-#line 9 "parser.y" // lalr1.cc:1167
+#line 9 "parser.y"
 } } } } //  ::sqf::parser::config::bison 
-#line 1442 "parser.tab.cc" // lalr1.cc:1167
-#line 262 "parser.y" // lalr1.cc:1168
+#line 1542 "parser.tab.cc"
+
+#line 263 "parser.y"
 
 #ifdef __GNUG__
     #pragma GCC diagnostic pop
@@ -1448,12 +1549,11 @@ namespace sqf { namespace parser { namespace config { namespace bison  {
     #pragma warning(pop)
 #endif
 
-#include "config_parser.hpp"
 namespace sqf::parser::config::bison
 {
     void parser::error(const location_type& loc, const std::string& msg)
     {
-        actual.__log(logmessage::config::ParseError({ *loc.begin.filename, loc.begin.line, loc.begin.column }, msg));
+        actual.__log(logmessage::config::ParseError({ *loc.begin.filename, (size_t)loc.begin.line, (size_t)loc.begin.column }, msg));
     }
     inline parser::symbol_type yylex(::sqf::parser::config::tokenizer& tokenizer)
     {
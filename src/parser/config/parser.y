@@ -45,6 +45,7 @@
      namespace sqf::parser::config
      {
           class parser;
+          class builder;
      }
      namespace sqf::parser::config::bison
      {
@@ -57,8 +58,6 @@
             STATEMENTS,
             CLASS_DEF,
             CLASS_DEF_EXT,
-            CLASS,
-            CLASS_EXT,
             DELETE_CLASS,
             FIELD,
             FIELD_ARRAY,
@@ -84,11 +83,11 @@
 
             void append(astnode node)
             {
-                children.push_back(node);
+                children.push_back(std::move(node));
             }
             void append_children(const astnode& other)
             { 
-                for (auto node : other.children)
+                for (auto& node : other.children)
                 {
                     append(node); 
                 } 
@@ -100,6 +99,7 @@
 {
     
     #include "../../runtime/runtime.h"
+    #include "config_parser.hpp"
      namespace sqf::parser::config::bison
      {
           // Return the next token.
@@ -109,7 +109,7 @@
 
 %lex-param { ::sqf::parser::config::tokenizer &tokenizer }
 %parse-param { ::sqf::parser::config::tokenizer &tokenizer }
-%parse-param { ::sqf::parser::config::bison::astnode& result }
+%parse-param { ::sqf::parser::config::builder& builder }
 %parse-param { ::sqf::parser::config::parser& actual }
 %locations
 %define parse.error verbose
@@ -143,8 +143,7 @@
 %token <tokenizer::token> STRING
 %token <tokenizer::token> ANY
 
-%type <::sqf::parser::config::bison::astnode> topstatements topstatement statements statement arrayvalue
-%type <::sqf::parser::config::bison::astnode> classdef deleteclass classbody field string number array
+%type <::sqf::parser::config::bison::astnode> classhead deleteclass field string number array arrayvalue
 %type <::sqf::parser::config::bison::astnode> arrayvaluelist anyval anyarr anyp anyarray anyvalue ident
 
 %start start
@@ -154,57 +153,59 @@
 /*** BEGIN - Change the grammar rules below ***/
 /*** BEGIN - Change the grammar rules below ***/
 /*** BEGIN - Change the grammar rules below ***/
-start: END_OF_FILE                                      { result = ::sqf::parser::config::bison::astnode{}; }
-     | topstatements                                    { result = ::sqf::parser::config::bison::astnode{}; result.append($1); }
-     | separators                                       { result = ::sqf::parser::config::bison::astnode{}; }
-     | separators topstatements                         { result = ::sqf::parser::config::bison::astnode{}; result.append($2); }
+start: END_OF_FILE
+     | topstatements
+     | separators
+     | separators topstatements
      ;
 separators: ";"
           | separators ";"
           ;
-topstatements: topstatement                             { $$ = ::sqf::parser::config::bison::astnode{ astkind::STATEMENTS }; $$.append($1); }
-             | topstatements separators                 { $$ = $1; }
-             | topstatements separators topstatement    { $$ = $1; $$.append($3); }
+topstatements: topstatement
+             | topstatements separators
+             | topstatements separators topstatement
              ;
-topstatement: classdef                                  { $$ = $1; }
-            | deleteclass                               { $$ = $1; }
+topstatement: classdef
+            | deleteclass                               { builder.apply($1); }
             ;
-statements: statement                                   { $$ = ::sqf::parser::config::bison::astnode{ astkind::STATEMENTS }; $$.append($1); }
-          | statements separators                       { $$ = $1; }
-          | statements separators statement             { $$ = $1; $$.append($3); }
+statements: statement
+          | statements separators
+          | statements separators statement
           ;
-statement: classdef                                     { $$ = $1; }
-         | field                                        { $$ = $1; }
-         | deleteclass                                  { $$ = $1; }
+statement: classdef
+         | field                                        { builder.apply($1); }
+         | deleteclass                                  { builder.apply($1); }
          ;
 
-classdef: "class" ident                                 { $$ = ::sqf::parser::config::bison::astnode{ astkind::CLASS_DEF, $1 }; $$.append($2); }
-        | "class" ident ":" ident                       { $$ = ::sqf::parser::config::bison::astnode{ astkind::CLASS_DEF_EXT, $1 }; $$.append($2); $$.append($4); }
-        | "class" ident classbody                       { $$ = ::sqf::parser::config::bison::astnode{ astkind::CLASS, $1 }; $$.append($2); $$.append($3); }
-        | "class" ident ":" ident classbody             { $$ = ::sqf::parser::config::bison::astnode{ astkind::CLASS_EXT, $1 }; $$.append($2); $$.append($4); $$.append($5); }
+classdef: classhead                                     { builder.apply($1); }
+        | classhead "{"                                 { builder.open($1); }
+          classbody                                     { builder.close(); }
         ;
-deleteclass: "delete" ident                             { $$ = ::sqf::parser::config::bison::astnode{ astkind::DELETE_CLASS, $1 }; $$.append($2); }
+classhead: "class" ident                                { $$ = ::sqf::parser::config::bison::astnode{ astkind::CLASS_DEF, $1 }; $$.append(std::move($2)); }
+         | "class" ident ":" ident                      { $$ = ::sqf::parser::config::bison::astnode{ astkind::CLASS_DEF_EXT, $1 }; $$.append(std::move($2)); $$.append(std::move($4)); }
+         ;
+deleteclass: "delete" ident                             { $$ = ::sqf::parser::config::bison::astnode{ astkind::DELETE_CLASS, $1 }; $$.append(std::move($2)); }
            ;
 
-classbody: "{" "}"                                      { $$ = ::sqf::parser::config::bison::astnode{ astkind::STATEMENTS }; }
-         | "{" statements "}"                           { $$ = $2; }
+classbody: "}"
+         | statements "}"
          ;
 
 field: ident "=" anyvalue
      {
          $$ = ::sqf::parser::config::bison::astnode{ astkind::FIELD, $2 };
-         $$.append($1);
+         $$.append(std::move($1));
          if ($3.children.size() == 1 && $3.children[0].kind != astkind::ANY)
          {
-            $$.append($3.children[0]);
+            $$.append(std::move($3.children[0]));
          }
          else
          {
-            $$.append($3);
+            $$.append(std::move($3));
          }
      }
-     | ident "[" "]" "=" array                          { $$ = ::sqf::parser::config::bison::astnode{ astkind::FIELD_ARRAY, $4 }; $$.append($1); $$.append($5); }
-     | ident "[" "]" "+=" array                         { $$ = ::sqf::parser::config::bison::astnode{ astkind::FIELD_ARRAY_APPEND, $4 }; $$.append($1); $$.append($5); }
+     | ident "[" "]" "=" array                          { $$ = ::sqf::parser::config::bison::astnode{ astkind::FIELD_ARRAY, $4 }; $$.append(std::move($1)); $$.append(std::move($5)); }
+     | ident "[" "]" "+=" array                         { $$ = ::sqf::parser::config::bison::astnode{ astkind::FIELD_ARRAY_APPEND, $4 }; $$.append(std::move($1)); $$.append(std::move($5)); }
      ;
 
 ident: IDENT                                            { $$ = ::sqf::parser::config::bison::astnode{ astkind::IDENT, $1 }; }
@@ -215,47 +216,47 @@ number: NUMBER                                          { $$ = ::sqf::parser::co
       | HEXNUMBER                                       { $$ = ::sqf::parser::config::bison::astnode{ astkind::NUMBER_HEXADECIMAL, $1 }; }
       ;
 array: "{" "}"                                          { $$ = ::sqf::parser::config::bison::astnode{ astkind::ARRAY }; }
-     | "{" arrayvaluelist "}"                           { $$ = $2; }
+     | "{" arrayvaluelist "}"                           { $$ = std::move($2); }
      ;
-arrayvalue: array                                       { $$ = $1; }
+arrayvalue: array                                       { $$ = std::move($1); }
           | anyarray
           {
               if ($1.children.size() == 1 && $1.children[0].kind != astkind::ANY)
               {
-                 $$ = $1.children[0];
+                 $$ = std::move($1.children[0]);
               }
               else
               {
-                 $$ = $1;
+                 $$ = std::move($1);
               }
           }
           ;
-arrayvaluelist: arrayvalue                              { $$ = ::sqf::parser::config::bison::astnode{ astkind::ARRAY }; $$.append($1); }
-              | arrayvaluelist "," arrayvalue           { $$ = $1; $$.append($3); }
+arrayvaluelist: arrayvalue                              { $$ = ::sqf::parser::config::bison::astnode{ astkind::ARRAY }; $$.append(std::move($1)); }
+              | arrayvaluelist "," arrayvalue           { $$ = std::move($1); $$.append(std::move($3)); }
               ;
-anyval: anyp                                            { $$ = $1; }
+anyval: anyp                                            { $$ = std::move($1); }
       | "{"                                             { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANY, $1 }; }
       | "}"                                             { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANY, $1 }; }
       | ","                                             { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANY, $1 }; }
       ;
-anyarr: anyp                                            { $$ = $1; }
+anyarr: anyp                                            { $$ = std::move($1); }
       ;
 anyp: "class"                                           { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANY, $1 }; }
     | "delete"                                          { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANY, $1 }; }
-    | number                                            { $$ = $1; }
-    | string                                            { $$ = $1; }
-    | ident                                             { $$ = $1; }
+    | number                                            { $$ = std::move($1); }
+    | string                                            { $$ = std::move($1); }
+    | ident                                             { $$ = std::move($1); }
     | "["                                               { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANY, $1 }; }
     | "]"                                               { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANY, $1 }; }
     | ":"                                               { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANY, $1 }; }
     | "="                                               { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANY, $1 }; }
     | ANY                                               { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANY, $1 }; }
     ;
-anyarray: anyarr                                        { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANYSTRING }; $$.append($1); }
-        | anyarray anyarr                               { $$ = $1; $$.append($2); }
+anyarray: anyarr                                        { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANYSTRING }; $$.append(std::move($1)); }
+        | anyarray anyarr                               { $$ = std::move($1); $$.append(std::move($2)); }
         ;
-anyvalue: anyval                                        { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANYSTRING }; $$.append($1); }
-        | anyvalue anyval                               { $$ = $1; $$.append($2); }
+anyvalue: anyval                                        { $$ = ::sqf::parser::config::bison::astnode{ astkind::ANYSTRING }; $$.append(std::move($1)); }
+        | anyvalue anyval                               { $$ = std::move($1); $$.append(std::move($2)); }
         ;
 
 
@@ -267,12 +268,11 @@ anyvalue: anyval                                        { $$ = ::sqf::parser::co
     #pragma warning(pop)
 #endif
 
-#include "config_parser.hpp"
 namespace sqf::parser::config::bison
 {
     void parser::error(const location_type& loc, const std::string& msg)
     {
-        actual.__log(logmessage::config::ParseError({ *loc.begin.filename, loc.begin.line, loc.begin.column }, msg));
+        actual.__log(logmessage::config::ParseError({ *loc.begin.filename, (size_t)loc.begin.line, (size_t)loc.begin.column }, msg));
     }
     inline parser::symbol_type yylex(::sqf::parser::config::tokenizer& tokenizer)
     {
@@ -12,6 +12,7 @@
 #include <string>
 #include <optional>
 #include <iostream>
+#include <atomic>
 
 #if defined(DF__SQF_PREPROC__TRACE_MACRO_RESOLVE) || defined(DF__SQF_PREPROC__TRACE_MACRO_PARSE)
 #include <iostream>
@@ -65,20 +66,14 @@ void sqf::parser::preprocessor::impl_default::instance::replace_stringify(
         }
         else
         {
-            auto macro_res = std::find_if(
-                m_macros.begin(),
-                m_macros.end(),
-                [word](std::unordered_map<std::string, ::sqf::runtime::parser::macro>::value_type m) -> bool {
-                return m.first.compare(word) == 0;
-            }
-            );
-            if (macro_res == m_macros.end())
+            auto macro_res = m_macros.find(word);
+            if (!macro_res)
             {
                 sstream << '"' << word << '"';
             }
             else
             {
-                sstream << '"' << handle_macro(runtime, local_fileinfo, original_fileinfo, macro_res->second, param_map) << '"';
+                sstream << '"' << handle_macro(runtime, local_fileinfo, original_fileinfo, *macro_res, param_map) << '"';
             }
         }
     }
@@ -158,20 +153,14 @@ void sqf::parser::preprocessor::impl_default::instance::replace_concat(
     }
     else
     {
-        auto macro_res = std::find_if(
-            m_macros.begin(),
-            m_macros.end(),
-            [word](std::unordered_map<std::string, ::sqf::runtime::parser::macro>::value_type m) -> bool {
-            return m.first.compare(word) == 0;
-        }
-        );
-        if (macro_res == m_macros.end())
+        auto macro_res = m_macros.find(word);
+        if (!macro_res)
         {
             sstream << word;
         }
         else
         {
-            sstream << handle_macro(runtime, local_fileinfo, original_fileinfo, macro_res->second, param_map);
+            sstream << handle_macro(runtime, local_fileinfo, original_fileinfo, *macro_res, param_map);
         }
     }
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_RESOLVE
@@ -325,6 +314,12 @@ std::string sqf::parser::preprocessor::impl_default::instance::replace(::sqf::ru
     local_fileinfo.line = m.diag_info().line;
     if (m.has_callback())
     {
+        if (m_defer_eval && (m.name() == "__EVAL" || m.name() == "__EXEC" || m.name() == "__COUNTER__" || m.name() == "__COUNTER_RESET__"))
+        { // Evaluating is left to the caller, preprocessing of this file is aborted
+            m_eval_deferred = true;
+            m_errflag = true;
+            return "";
+        }
         return m(original_fileinfo, original_fileinfo, params, runtime);
     }
 
@@ -403,7 +398,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::replace(::sqf::ru
                 else
                 { // Check if word matches any macro
                     auto macro_res = m_macros.find(word);
-                    if (macro_res == m_macros.end())
+                    if (!macro_res)
                     { // word matches no macro, append to sstream
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_RESOLVE
                         std::cout << "\x1B[33m[PREPROCESSOR-RS]\033[0m" <<
@@ -415,7 +410,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::replace(::sqf::ru
                     }
                     else
                     { // word matches macro, handle it
-                        auto res = handle_macro(runtime, local_fileinfo, original_fileinfo, macro_res->second, parammap);
+                        auto res = handle_macro(runtime, local_fileinfo, original_fileinfo, *macro_res, parammap);
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_RESOLVE
                         std::cout << "\x1B[33m[PREPROCESSOR-RS]\033[0m" <<
                             "        " <<
@@ -507,19 +502,19 @@ std::string sqf::parser::preprocessor::impl_default::instance::handle_arg(::sqf:
                 inside_word = false;
                 auto word = local_fileinfo.content.substr(word_start, local_fileinfo.off - word_start - (!part_of_word ? 1 : 0));
                 auto res = try_get_macro(word);
-                if (res.has_value())
+                if (res)
                 {
-                    if (res.value().is_callable())
+                    if (res->is_callable())
                     {
                         local_fileinfo.move_back();
                     }
-                    auto handled = handle_macro(runtime, local_fileinfo, original_fileinfo, res.value(), param_map);
+                    auto handled = handle_macro(runtime, local_fileinfo, original_fileinfo, *res, param_map);
                     if (m_errflag)
                     {
                         return "";
                     }
                     sstream << handled;
-                    if (!res.value().is_callable() && !part_of_word)
+                    if (!res->is_callable() && !part_of_word)
                     {
                         local_fileinfo.move_back();
                     }
@@ -770,11 +765,11 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
         auto spaceIndex = spaceIter == line.end() ? std::string::npos : std::distance(line.begin(), spaceIter);
         if (bracketsIndex == std::string::npos && spaceIndex == std::string::npos)
         { // Empty define
-            if (try_get_macro(line).has_value())
+            if (m_macros.contains(line))
             {
                 log(err::MacroDefinedTwice(fileinfo.to_diag_info(), line));
             }
-            m_macros[line] = { fileinfo, line };
+            m_macros.set(line, { fileinfo, line });
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_PARSE
             std::cout << "\x1B[33m[PP-DEFINE-PARSE]\033[0m" <<
                 "        " <<
@@ -787,12 +782,12 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
             if (spaceIndex < bracketsIndex || bracketsIndex == std::string::npos) // std::string::npos does not need to be catched as bracketsIndex always < npos here
             { // First bracket was found after first space OR is not existing thus we have a simple define with a replace value here
                 auto name_tmp = line.substr(0, spaceIndex);
-                if (try_get_macro(name_tmp).has_value())
+                if (m_macros.contains(name_tmp))
                 {
                     log(err::MacroDefinedTwice(fileinfo.to_diag_info(), name_tmp));
                 }
                 std::string content(trim(line.substr(line[spaceIndex] == ' ' ? spaceIndex + 1 : spaceIndex))); // Special magic for '#define macro\'
-                m_macros[name_tmp] = { fileinfo, name_tmp, content };
+                m_macros.set(name_tmp, { fileinfo, name_tmp, content });
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_PARSE
                 std::cout << "\x1B[33m[PP-DEFINE-PARSE]\033[0m" <<
                     "        " <<
@@ -803,7 +798,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
             else
             { // We got a define with arguments here
                 auto name_tmp = line.substr(0, bracketsIndex);
-                if (try_get_macro(name_tmp).has_value())
+                if (m_macros.contains(name_tmp))
                 {
                     log(err::MacroDefinedTwice(fileinfo.to_diag_info(), name_tmp));
                 }
@@ -841,7 +836,7 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
                     content = (trim(line.substr(line[bracketsEndIndex + 1] == ' ' ? bracketsEndIndex + 2 : bracketsEndIndex + 1)));
                 }
 
-                m_macros[name_tmp] = { fileinfo, name_tmp, args, content };
+                m_macros.set(name_tmp, { fileinfo, name_tmp, args, content });
 #ifdef DF__SQF_PREPROC__TRACE_MACRO_PARSE
                 std::cout << "\x1B[33m[PP-DEFINE-PARSE]\033[0m" <<
                     "        " <<
@@ -859,15 +854,10 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
             return "\n";
         }
 
-        auto res = m_macros.find(static_cast<std::string>(line));
-        if (res == m_macros.end())
+        if (!m_macros.erase(static_cast<std::string>(line)))
         {
             log(err::MacroNotFound(fileinfo.to_diag_info(), line));
         }
-        else
-        {
-            m_macros.erase(res);
-        }
         return "\n";
     }
     else if (inst == "IFDEF")
@@ -876,8 +866,8 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
         {
             log(err::UnexpectedIfdef(fileinfo.to_diag_info()));
         }
-        auto res = m_macros.find(static_cast<std::string>(line));
-        current_file_scope().conditions.push_back({ res != m_macros.end(), fileinfo, fileinfo });
+        auto res = m_macros.contains(static_cast<std::string>(line));
+        current_file_scope().conditions.push_back({ res, fileinfo, fileinfo });
         return "\n";
     }
     else if (inst == "IFNDEF")
@@ -886,8 +876,8 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_ppinstructi
         {
             log(err::UnexpectedIfndef(fileinfo.to_diag_info()));
         }
-        auto res = m_macros.find(static_cast<std::string>(line));
-        current_file_scope().conditions.push_back({ res == m_macros.end(), fileinfo, fileinfo });
+        auto res = m_macros.contains(static_cast<std::string>(line));
+        current_file_scope().conditions.push_back({ !res, fileinfo, fileinfo });
         return "\n";
     }
     else if (inst == "ELSE")
@@ -1042,10 +1032,10 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_file(::sqf:
                         auto word = wordstream.str();
                         wordstream.str("");
                         auto m = try_get_macro(word);
-                        if (m.has_value())
+                        if (m)
                         {
                             fileinfo.move_back();
-                            auto res = handle_macro(runtime, fileinfo, fileinfo, m.value(), empty_parammap);
+                            auto res = handle_macro(runtime, fileinfo, fileinfo, *m, empty_parammap);
                             if (m_errflag)
                             {
                                 return res;
@@ -1092,10 +1082,10 @@ std::string sqf::parser::preprocessor::impl_default::instance::parse_file(::sqf:
     if (!word.empty())
     {
         auto m = try_get_macro(word);
-        if (m.has_value())
+        if (m)
         {
             fileinfo.move_back();
-            auto res = handle_macro(runtime, fileinfo, fileinfo, m.value(), empty_parammap);
+            auto res = handle_macro(runtime, fileinfo, fileinfo, *m, empty_parammap);
             if (m_errflag)
             {
                 return res;
@@ -1147,7 +1137,7 @@ std::string eval_macro_callback(
     auto res = runtime.evaluate_expression(params[0], success, false);
     return success ? res.data()->to_string_sqf() : "";
 }
-static int __counter__ = 0;
+static std::atomic<int> __counter__ = 0;
 std::string counter_macro_callback(
     const ::sqf::runtime::parser::macro& m,
     const ::sqf::runtime::diagnostics::diag_info dinf,
@@ -1199,24 +1189,24 @@ sqf::parser::preprocessor::impl_default::impl_default(Logger& logger) : CanLog(l
     // m_macros["__RAND_UINT32__"s] = { "__RAND_UINT32__"s, counter_macro_callback };
     // m_macros["__RAND_INT64__"s] = { "__RAND_INT64__"s, counter_macro_callback };
     // m_macros["__RAND_UINT64__"s] = { "__RAND_UINT64__"s, counter_macro_callback };
-    m_macros["__GAME_VER__"s] = { "__GAME_VER__"s, STR(SQFVM_RUNTIME_VERSION_MAJOR) "." STR(SQFVM_RUNTIME_VERSION_MINOR) "." STR(SQFVM_RUNTIME_VERSION_REVISION) };
-    m_macros["__GAME_VER_MAJ__"s] = { "__GAME_VER_MAJ__"s, STR(SQFVM_RUNTIME_VERSION_MAJOR) };
-    m_macros["__GAME_VER_MIN__"s] = { "__GAME_VER_MIN__"s, STR(SQFVM_RUNTIME_VERSION_MINOR) };
-    m_macros["__GAME_BUILD__"s] = { "__GAME_BUILD__"s, STR(SQFVM_RUNTIME_VERSION_REVISION) };
-    m_macros["__COUNTER__"s] = { "__COUNTER__"s, counter_macro_callback };
-    m_macros["__COUNTER_RESET__"s] = { "__COUNTER_RESET__"s, counter_reset_macro_callback };
-    m_macros["__FILE__"s] = { "__FILE__"s, file_macro_callback };
-    m_macros["__LINE__"s] = { "__LINE__"s, line_macro_callback };
-    m_macros["__EXEC"s] = { "__EXEC"s, { "EXPRESSION"s }, eval_macro_callback };
-    m_macros["__EVAL"s] = { "__EVAL"s, { "EXPRESSION"s }, eval_macro_callback };
-    m_macros["_SQFVM"s] = { "_SQFVM"s };
-    m_macros["_SQFVM_RUNTIME_VERSION_MAJOR"s] = { "_SQFVM_RUNTIME_VERSION_MAJOR"s, STR(SQFVM_RUNTIME_VERSION_MAJOR) };
-    m_macros["_SQFVM_RUNTIME_VERSION_MINOR"s] = { "_SQFVM_RUNTIME_VERSION_MINOR"s, STR(SQFVM_RUNTIME_VERSION_MINOR) };
-    m_macros["_SQFVM_RUNTIME_VERSION_REVISION"s] = { "_SQFVM_RUNTIME_VERSION_REVISION"s, STR(SQFVM_RUNTIME_VERSION_REVISION) };
+    m_macros.set("__GAME_VER__"s, { "__GAME_VER__"s, STR(SQFVM_RUNTIME_VERSION_MAJOR) "." STR(SQFVM_RUNTIME_VERSION_MINOR) "." STR(SQFVM_RUNTIME_VERSION_REVISION) });
+    m_macros.set("__GAME_VER_MAJ__"s, { "__GAME_VER_MAJ__"s, STR(SQFVM_RUNTIME_VERSION_MAJOR) });
+    m_macros.set("__GAME_VER_MIN__"s, { "__GAME_VER_MIN__"s, STR(SQFVM_RUNTIME_VERSION_MINOR) });
+    m_macros.set("__GAME_BUILD__"s, { "__GAME_BUILD__"s, STR(SQFVM_RUNTIME_VERSION_REVISION) });
+    m_macros.set("__COUNTER__"s, { "__COUNTER__"s, counter_macro_callback });
+    m_macros.set("__COUNTER_RESET__"s, { "__COUNTER_RESET__"s, counter_reset_macro_callback });
+    m_macros.set("__FILE__"s, { "__FILE__"s, file_macro_callback });
+    m_macros.set("__LINE__"s, { "__LINE__"s, line_macro_callback });
+    m_macros.set("__EXEC"s, { "__EXEC"s, { "EXPRESSION"s }, eval_macro_callback });
+    m_macros.set("__EVAL"s, { "__EVAL"s, { "EXPRESSION"s }, eval_macro_callback });
+    m_macros.set("_SQFVM"s, { "_SQFVM"s });
+    m_macros.set("_SQFVM_RUNTIME_VERSION_MAJOR"s, { "_SQFVM_RUNTIME_VERSION_MAJOR"s, STR(SQFVM_RUNTIME_VERSION_MAJOR) });
+    m_macros.set("_SQFVM_RUNTIME_VERSION_MINOR"s, { "_SQFVM_RUNTIME_VERSION_MINOR"s, STR(SQFVM_RUNTIME_VERSION_MINOR) });
+    m_macros.set("_SQFVM_RUNTIME_VERSION_REVISION"s, { "_SQFVM_RUNTIME_VERSION_REVISION"s, STR(SQFVM_RUNTIME_VERSION_REVISION) });
 #if defined(_DEBUG)
-    m_macros["_SQFVM_DEBUG"s] = { "_DEBUG"s };
+    m_macros.set("_SQFVM_DEBUG"s, { "_DEBUG"s });
 #endif
-
+    m_macros.freeze();
 }
 std::optional<std::string> sqf::parser::preprocessor::impl_default::preprocess(
     ::sqf::runtime::runtime& runtime,
@@ -1224,11 +1214,27 @@ std::optional<std::string> sqf::parser::preprocessor::impl_default::preprocess(
     ::sqf::runtime::fileio::pathinfo pathinfo,
     std::vector<std::string>* out_included,
     std::vector<::sqf::runtime::parser::macro>* out_macros)
+{
+    return preprocess(runtime, view, pathinfo, out_included, out_macros, get_logger(), nullptr);
+}
+std::optional<std::string> sqf::parser::preprocessor::impl_default::preprocess(
+    ::sqf::runtime::runtime& runtime,
+    std::string_view view,
+    ::sqf::runtime::fileio::pathinfo pathinfo,
+    std::vector<std::string>* out_included,
+    std::vector<::sqf::runtime::parser::macro>* out_macros,
+    Logger& logger,
+    bool* out_eval_deferred) const
 {
     preprocessorfileinfo fileinfo(pathinfo);
     fileinfo.content = view;
-    instance i(this, get_logger(), m_macros);
+    instance i(this, logger, m_macros);
+    i.m_defer_eval = out_eval_deferred != nullptr;
     auto res = i.parse_file(runtime, fileinfo);
+    if (out_eval_deferred)
+    {
+        *out_eval_deferred = i.m_eval_deferred;
+    }
     if (out_included)
     {
         for (auto entry : i.m_visited)
@@ -1238,10 +1244,7 @@ std::optional<std::string> sqf::parser::preprocessor::impl_default::preprocess(
     }
     if (out_macros)
     {
-        for (auto entry : i.m_macros)
-        {
-            out_macros->push_back(entry.second);
-        }
+        i.m_macros.for_each([out_macros](const ::sqf::runtime::parser::macro& m) { out_macros->push_back(m); });
     }
     if (i.errflag())
     {
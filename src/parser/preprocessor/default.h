@@ -9,6 +9,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <optional>
+#include <memory>
 
 
 namespace sqf::parser::preprocessor
@@ -229,8 +230,97 @@ namespace sqf::parser::preprocessor
             operator ::sqf::runtime::diagnostics::diag_info() const { return to_diag_info(); }
             operator ::sqf::runtime::fileio::pathinfo() const { return pathinf; }
         };
+        /// <summary>
+        /// Macros visible at some point of preprocessing.
+        /// Consists of an immutable base, shared between all copies of a table, and an overlay
+        /// holding the macros (un-)defined on top of it. Copying a table thus only copies the overlay.
+        /// </summary>
+        class macro_table
+        {
+        public:
+            using map = std::unordered_map<std::string, ::sqf::runtime::parser::macro>;
+        private:
+            std::shared_ptr<const map> m_base;
+            // Empty optionals mark macros of m_base that got undefined.
+            std::unordered_map<std::string, std::optional<::sqf::runtime::parser::macro>> m_overlay;
+        public:
+            macro_table() : m_base(std::make_shared<const map>()), m_overlay() {}
+
+            const ::sqf::runtime::parser::macro* find(const std::string& name) const
+            {
+                auto overlay_res = m_overlay.find(name);
+                if (overlay_res != m_overlay.end())
+                {
+                    return overlay_res->second.has_value() ? &*overlay_res->second : nullptr;
+                }
+                auto res = m_base->find(name);
+                return res == m_base->end() ? nullptr : &res->second;
+            }
+            bool contains(const std::string& name) const { return find(name) != nullptr; }
+            void set(std::string name, ::sqf::runtime::parser::macro m) { m_overlay[std::move(name)] = std::move(m); }
+            bool erase(const std::string& name)
+            {
+                if (m_base->find(name) == m_base->end())
+                {
+                    return m_overlay.erase(name) > 0;
+                }
+                auto res = m_overlay.try_emplace(name);
+                if (res.second)
+                { // Hides the macro of m_base
+                    return true;
+                }
+                auto existed = res.first->second.has_value();
+                res.first->second.reset();
+                return existed;
+            }
+
+            /// <summary>
+            /// Folds the overlay into a new base.
+            /// Copies taken before keep referencing the old base.
+            /// </summary>
+            void freeze()
+            {
+                if (m_overlay.empty())
+                {
+                    return;
+                }
+                auto merged = std::make_shared<map>(*m_base);
+                for (auto& pair : m_overlay)
+                {
+                    if (pair.second.has_value())
+                    {
+                        merged->insert_or_assign(pair.first, *pair.second);
+                    }
+                    else
+                    {
+                        merged->erase(pair.first);
+                    }
+                }
+                m_base = std::move(merged);
+                m_overlay.clear();
+            }
+
+            template<typename TFunc>
+            void for_each(TFunc func) const
+            {
+                for (auto& pair : *m_base)
+                {
+                    if (m_overlay.find(pair.first) == m_overlay.end())
+                    {
+                        func(pair.second);
+                    }
+                }
+                for (auto& pair : m_overlay)
+                {
+                    if (pair.second.has_value())
+                    {
+                        func(*pair.second);
+                    }
+                }
+            }
+        };
     private:
-        std::unordered_map<std::string, ::sqf::runtime::parser::macro> m_macros;
+        macro_table m_macros;
         std::unordered_map<std::string, ::sqf::runtime::parser::pragma> m_pragmas;
         struct condition_scope
         {
@@ -246,12 +336,15 @@ namespace sqf::parser::preprocessor
         class instance : public CanLog
         {
         public:
-            instance(impl_default* owner, Logger& logger, std::unordered_map<std::string, ::sqf::runtime::parser::macro> macros) : CanLog(logger), m_owner(owner), m_macros(macros) {};
+            instance(const impl_default* owner, Logger& logger, const macro_table& macros) : CanLog(logger), m_owner(owner), m_macros(macros) {};
             std::vector<file_scope> m_file_scopes;
             std::unordered_set<std::string> m_visited;
             bool m_errflag = false;
-            impl_default* m_owner;
-            std::unordered_map<std::string, ::sqf::runtime::parser::macro> m_macros;
+            // Set to not evaluate __EVAL, __EXEC and the __COUNTER__ macros, m_eval_deferred tells whether any was encountered.
+            bool m_defer_eval = false;
+            bool m_eval_deferred = false;
+            const impl_default* m_owner;
+            macro_table m_macros;
 
             void replace_stringify(
                 ::sqf::runtime::runtime& runtime,
@@ -305,15 +398,7 @@ namespace sqf::parser::preprocessor
             void push_path(const ::sqf::runtime::fileio::pathinfo pathinfo);
             void pop_path(preprocessorfileinfo& preprocessorfileinfo);
 
-            std::optional<::sqf::runtime::parser::macro> try_get_macro(const std::string macro_name) const
-            {
-                auto res = m_macros.find(macro_name);
-                if (res == m_macros.end())
-                {
-                    return {};
-                }
-                return res->second;
-            }
+            const ::sqf::runtime::parser::macro* try_get_macro(const std::string& macro_name) const { return m_macros.find(macro_name); }
         };
     public:
         impl_default(Logger& logger);
@@ -325,7 +410,30 @@ namespace sqf::parser::preprocessor
             std::vector<std::string>* out_included,
             std::vector<::sqf::runtime::parser::macro>* out_macros);
 
-        virtual void push_back(::sqf::runtime::parser::macro m) override { m_macros[std::string(m.name())] = m; };
+        /// <summary>
+        /// Preprocesses using the provided logger instead of the one of the preprocessor.
+        /// Does not modify the preprocessor, hence multiple files may be preprocessed concurrently
+        /// as long as no macros or pragmas get added meanwhile.
+        /// __EVAL and __EXEC execute code in the runtime, which is not safe from multiple threads.
+        /// __COUNTER__ and __COUNTER_RESET__ share one counter, so their results depend on the order files are preprocessed in.
+        /// If out_eval_deferred is provided, none of them are evaluated: Preprocessing fails instead and out_eval_deferred is set,
+        /// leaving it to the caller to preprocess the file again on the thread owning the runtime.
+        /// </summary>
+        std::optional<std::string> preprocess(
+            ::sqf::runtime::runtime& runtime,
+            std::string_view view,
+            ::sqf::runtime::fileio::pathinfo pathinfo,
+            std::vector<std::string>* out_included,
+            std::vector<::sqf::runtime::parser::macro>* out_macros,
+            Logger& logger,
+            bool* out_eval_deferred) const;
+
+        /// <summary>
+        /// Folds the macros added via push_back into the shared base of the macro table.
+        /// Every preprocess run copies the added macros, so call this once they are set up (eg. after the -D defines).
+        /// </summary>
+        void freeze_macros() { m_macros.freeze(); }
+        virtual void push_back(::sqf::runtime::parser::macro m) override { m_macros.set(std::string(m.name()), std::move(m)); };
         virtual void push_back(::sqf::runtime::parser::pragma p) override { m_pragmas[std::string(p.name())] = p; };
         virtual ~impl_default() override { }
         virtual std::optional<std::string> preprocess(::sqf::runtime::runtime& runtime, std::string_view view, ::sqf::runtime::fileio::pathinfo pathinfo) override
@@ -334,11 +442,11 @@ namespace sqf::parser::preprocessor
         std::optional<::sqf::runtime::parser::macro> try_get_macro(const std::string macro_name) const
         {
             auto res = m_macros.find(macro_name);
-            if (res == m_macros.end())
+            if (!res)
             {
                 return {};
             }
-            return res->second;
+            return *res;
         }
         std::optional<::sqf::runtime::parser::pragma> try_get_pragma(const std::string name) const
         {
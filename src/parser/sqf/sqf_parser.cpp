@@ -37,9 +37,17 @@ namespace sqf::parser::sqf::util
         }
         return std::string(arr.data(), arr.size());
     }
+    static ::sqf::runtime::diagnostics::source_location location_of(const std::shared_ptr<::sqf::runtime::diagnostics::source_file>& source, const ::sqf::parser::sqf::tokenizer::token& token, size_t column)
+    {
+        return { source, source->path_id(*token.path), token.line, column, token.offset, token.contents.length() };
+    }
+    static ::sqf::runtime::diagnostics::source_location location_of(const std::shared_ptr<::sqf::runtime::diagnostics::source_file>& source, const ::sqf::parser::sqf::tokenizer::token& token)
+    {
+        return location_of(source, token, token.column);
+    }
 }
 
-void ::sqf::parser::sqf::parser::to_assembly(std::string_view contents, const ::sqf::parser::sqf::bison::astnode& node, std::vector<::sqf::runtime::instruction::sptr>& set)
+void ::sqf::parser::sqf::parser::to_assembly(const std::shared_ptr<::sqf::runtime::diagnostics::source_file>& source, const ::sqf::parser::sqf::bison::astnode& node, std::vector<::sqf::runtime::instruction::sptr>& set)
 {
 
     switch (node.kind)
@@ -55,33 +63,34 @@ void ::sqf::parser::sqf::parser::to_assembly(std::string_view contents, const ::
     case bison::astkind::EXP8:
     case bison::astkind::EXP9:
     {
-        to_assembly(contents, node.children[0], set);
-        to_assembly(contents, node.children[1], set);
+        to_assembly(source, node.children[0], set);
+        to_assembly(source, node.children[1], set);
         auto s = std::string(node.token.contents);
         std::transform(s.begin(), s.end(), s.begin(), [](char& c) { return (char)std::tolower((int)c); });
         auto inst = std::make_shared<::sqf::opcodes::call_binary>(s, (short)(((short)node.kind - (short)bison::astkind::EXP0) + 1));
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+        inst->location(util::location_of(source, node.token));
         set.push_back(inst);
     }
     break;
     case bison::astkind::EXPU:
     {
         auto s = std::string(node.token.contents);
-        to_assembly(contents, node.children[0], set);
+        to_assembly(source, node.children[0], set);
         if (node.children[0].kind == bison::astkind::NUMBER && (s == "+" || s == "-"))
         {
             if (s == "-")
             {
                 auto child = std::static_pointer_cast<::sqf::opcodes::push>(set.back());
-                auto scalar = child->value().data<::sqf::types::d_scalar>();
-                scalar->value(-scalar->value());
+                auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(-child->value().data<::sqf::types::d_scalar, float>()));
+                inst->location(child->location());
+                set.back() = inst;
             }
         }
         else
         {
             std::transform(s.begin(), s.end(), s.begin(), [](char& c) { return (char)std::tolower((int)c); });
             auto inst = std::make_shared<::sqf::opcodes::call_unary>(s);
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             set.push_back(inst);
         }
     }
@@ -91,7 +100,7 @@ void ::sqf::parser::sqf::parser::to_assembly(std::string_view contents, const ::
         auto s = std::string(node.token.contents);
         std::transform(s.begin(), s.end(), s.begin(), [](char& c) { return (char)std::tolower((int)c); });
         auto inst = std::make_shared<::sqf::opcodes::call_nular>(s);
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+        inst->location(util::location_of(source, node.token));
         set.push_back(inst);
     }
     break;
@@ -106,13 +115,13 @@ void ::sqf::parser::sqf::parser::to_assembly(std::string_view contents, const ::
                 ::sqf::runtime::value(
                     std::make_shared<::sqf::types::d_scalar>(
                         hexnum)));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             set.push_back(inst);
         }
         catch (std::out_of_range&)
         {
             auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>(std::nanf(""))));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             __log(logmessage::assembly::NumberOutOfRange(inst->diag_info()));
             set.push_back(inst);
         }
@@ -123,13 +132,13 @@ void ::sqf::parser::sqf::parser::to_assembly(std::string_view contents, const ::
         try
         {
             auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>((double)std::stod(std::string(node.token.contents)))));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             set.push_back(inst);
         }
         catch (std::out_of_range&)
         {
             auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_scalar>(std::nanf(""))));
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             __log(logmessage::assembly::NumberOutOfRange(inst->diag_info()));
             set.push_back(inst);
         }
@@ -138,21 +147,21 @@ void ::sqf::parser::sqf::parser::to_assembly(std::string_view contents, const ::
     case bison::astkind::STRING:
     {
         auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_string>(::sqf::types::d_string::from_sqf(node.token.contents))));
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+        inst->location(util::location_of(source, node.token));
         set.push_back(inst);
     }
     break;
     case bison::astkind::BOOLEAN_TRUE:
     {
         auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(true));
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+        inst->location(util::location_of(source, node.token));
         set.push_back(inst);
     }
     break;
     case bison::astkind::BOOLEAN_FALSE:
     {
         auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(false));
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+        inst->location(util::location_of(source, node.token));
         set.push_back(inst);
     }
     break;
@@ -165,15 +174,15 @@ void ::sqf::parser::sqf::parser::to_assembly(std::string_view contents, const ::
             if (i != 0)
             {
                 auto inst = std::make_shared<::sqf::opcodes::end_statement>();
-                inst->diag_info({ previous_node.token.line, previous_node.token.column + previous_node.token.contents.length(), previous_node.token.offset, { *previous_node.token.path, {} }, create_code_segment(contents, previous_node.token.offset, previous_node.token.contents.length()) });
+                inst->location(util::location_of(source, previous_node.token, previous_node.token.column + previous_node.token.contents.length()));
                 tmp_set.push_back(inst);
             }
             previous_node = node.children[i];
-            to_assembly(contents, previous_node, tmp_set);
+            to_assembly(source, previous_node, tmp_set);
         }
         auto inst_set = ::sqf::runtime::instruction_set(tmp_set);
         auto inst = std::make_shared<::sqf::opcodes::push>(::sqf::runtime::value(std::make_shared<::sqf::types::d_code>(inst_set)));
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+        inst->location(util::location_of(source, node.token));
         set.push_back(inst);
     }
     break;
@@ -181,42 +190,42 @@ void ::sqf::parser::sqf::parser::to_assembly(std::string_view contents, const ::
     {
         for (auto& subnode : node.children)
         {
-            to_assembly(contents, subnode, set);
+            to_assembly(source, subnode, set);
         }
         auto inst = std::make_shared<::sqf::opcodes::make_array>(node.children.size());
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+        inst->location(util::location_of(source, node.token));
         set.push_back(inst);
     }
     break;
     case bison::astkind::ASSIGNMENT:
     {
-        to_assembly(contents, node.children[1], set);
+        to_assembly(source, node.children[1], set);
         if (node.children[0].children.empty() && node.children[0].token.type == tokenizer::etoken::t_ident)
         {
             auto inst = std::make_shared<::sqf::opcodes::assign_to>(node.children[0].token.contents);
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             set.push_back(inst);
         }
         else
         {
             auto inst = std::make_shared<::sqf::opcodes::assign_to>(""s);
-            inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+            inst->location(util::location_of(source, node.token));
             set.push_back(inst);
         }
     }
     break;
     case bison::astkind::ASSIGNMENT_LOCAL:
     {
-        to_assembly(contents, node.children[0], set);
+        to_assembly(source, node.children[0], set);
         auto inst = std::make_shared<::sqf::opcodes::assign_to_local>(node.token.contents);
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+        inst->location(util::location_of(source, node.token));
         set.push_back(inst);
     }
     break;
     case bison::astkind::IDENT:
     {
         auto inst = std::make_shared<::sqf::opcodes::get_variable>(node.token.contents);
-        inst->diag_info({ node.token.line, node.token.column, node.token.offset, { *node.token.path, {} }, create_code_segment(contents, node.token.offset, node.token.contents.length()) });
+        inst->location(util::location_of(source, node.token));
         set.push_back(inst);
     }
     break;
@@ -228,11 +237,11 @@ void ::sqf::parser::sqf::parser::to_assembly(std::string_view contents, const ::
             if (i != 0)
             {
                 auto inst = std::make_shared<::sqf::opcodes::end_statement>();
-                inst->diag_info({ previous_node.token.line, previous_node.token.column + previous_node.token.contents.length(), previous_node.token.offset, { *previous_node.token.path, {} }, create_code_segment(contents, previous_node.token.offset, previous_node.token.contents.length()) });
+                inst->location(util::location_of(source, previous_node.token, previous_node.token.column + previous_node.token.contents.length()));
                 set.push_back(inst);
             }
             previous_node = node.children[i];
-            to_assembly(contents, previous_node, set);
+            to_assembly(source, previous_node, set);
         }
     }
     }
@@ -247,7 +256,8 @@ bool sqf::parser::sqf::parser::get_tree(::sqf::runtime::runtime& runtime, ::sqf:
 
 std::optional<sqf::runtime::instruction_set> sqf::parser::sqf::parser::parse(::sqf::runtime::runtime& runtime, std::string contents, ::sqf::runtime::fileio::pathinfo file)
 {
-    tokenizer t(contents.begin(), contents.end(), file.physical);
+    auto source = std::make_shared<::sqf::runtime::diagnostics::source_file>(std::move(contents));
+    tokenizer t(source->buffer().begin(), source->buffer().end(), file.physical);
     ::sqf::parser::sqf::bison::astnode res;
     ::sqf::parser::sqf::bison::parser p(t, res, *this, runtime);
     // p.set_debug_level(1);
@@ -257,7 +267,7 @@ std::optional<sqf::runtime::instruction_set> sqf::parser::sqf::parser::parse(::s
         return {};
     }
     std::vector<::sqf::runtime::instruction::sptr> vec;
-    to_assembly(contents, res, vec);
+    to_assembly(source, res, vec);
     return vec;
 }
 
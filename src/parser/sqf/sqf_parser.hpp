@@ -2,6 +2,7 @@
 #include "../../runtime/parser/sqf.h"
 #include "../../runtime/logging.h"
 #include "../../runtime/diagnostics/diag_info.h"
+#include "../../runtime/diagnostics/source_location.h"
 #include "../../runtime/fileio.h"
 #include "../../runtime/util.h"
 #include "../../runtime/instruction_set.h"
@@ -22,7 +23,7 @@ namespace sqf::parser::sqf
     class parser : public ::sqf::runtime::parser::sqf, public CanLog
     {
     private:
-        void to_assembly(std::string_view contents, const ::sqf::parser::sqf::bison::astnode& node, std::vector<::sqf::runtime::instruction::sptr>& set);
+        void to_assembly(const std::shared_ptr<::sqf::runtime::diagnostics::source_file>& source, const ::sqf::parser::sqf::bison::astnode& node, std::vector<::sqf::runtime::instruction::sptr>& set);
     public:
         parser(Logger& logger) : CanLog(logger)
         {
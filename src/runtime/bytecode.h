@@ -0,0 +1,165 @@
+#pragma once
+#include "value.h"
+#include "sqfop.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace sqf::runtime
+{
+    class instruction;
+    namespace bytecode
+    {
+        /// <summary>
+        /// The operations known to the flat dispatch loop.
+        /// Anything not listed here is lowered to opkind::generic,
+        /// which executes the source instruction via its virtual execute method.
+        /// </summary>
+        enum class opkind : uint8_t
+        {
+            generic,
+            push,
+            end_statement,
+            make_array,
+            get_variable,
+            get_local,
+            assign_to,
+            assign_to_existing_local,
+            assign_to_local,
+            call_nular,
+            call_unary,
+            call_binary
+        };
+
+        /// <summary>
+        /// Operand of get_variable and assign_to, plus the variable of a local slot.
+        /// </summary>
+        struct variable_operand
+        {
+            std::string name;
+            // Lowercased name, used for the actual lookup (see sqf::runtime::value_scope::to_key).
+            std::string key;
+        };
+
+        /// <summary>
+        /// Operand of the call_* ops: the operator to call plus the inline cache of its resolved overloads.
+        /// </summary>
+        template<class TOperator, size_t TSize>
+        struct call_site
+        {
+            sqf::runtime::sqfop_id id;
+            std::string name;
+            mutable sqf::runtime::sqfop_inline_cache<TOperator, TSize> cache;
+        };
+        using nular_call = call_site<sqf::runtime::sqfop_nular, 1>;
+        using unary_call = call_site<sqf::runtime::sqfop_unary, 2>;
+        using binary_call = call_site<sqf::runtime::sqfop_binary, 4>;
+
+        /// <summary>
+        /// A single, fixed-size operation of a lowered instruction set.
+        /// </summary>
+        struct op
+        {
+            opkind kind;
+            /// <summary>
+            /// Kind specific operand.
+            /// push: index into the constant pool
+            /// make_array: array size
+            /// get_variable, assign_to: index into the variable pool
+            /// get_local, assign_to_existing_local, assign_to_local: local slot (see program::local)
+            /// call_*: index into the call site pool of the respective kind
+            /// </summary>
+            uint32_t operand;
+            /// <summary>
+            /// The instruction this op was lowered from.
+            /// Used for diagnostics and to execute opkind::generic.
+            /// Owned by the instruction_set the program belongs to.
+            /// </summary>
+            const sqf::runtime::instruction* source;
+        };
+
+        /// <summary>
+        /// The lowered form of an instruction_set:
+        /// A contiguous array of operations plus the constants they reference.
+        /// Variables and call sites are pooled per name, so all ops referring to the same operator share one inline cache.
+        /// </summary>
+        class program final
+        {
+        private:
+            std::vector<op> m_ops;
+            std::vector<sqf::runtime::value> m_constants;
+            std::vector<variable_operand> m_variables;
+            std::vector<variable_operand> m_locals;
+            std::vector<nular_call> m_nular_calls;
+            std::vector<unary_call> m_unary_calls;
+            std::vector<binary_call> m_binary_calls;
+            // Pool indices by name (variables), key (locals) or operator id (call sites).
+            std::unordered_map<std::string, uint32_t> m_variable_indices;
+            std::unordered_map<std::string, uint32_t> m_local_indices;
+            std::unordered_map<sqf::runtime::sqfop_id, uint32_t> m_nular_indices;
+            std::unordered_map<sqf::runtime::sqfop_id, uint32_t> m_unary_indices;
+            std::unordered_map<sqf::runtime::sqfop_id, uint32_t> m_binary_indices;
+
+            // Returns the index of the pool entry stored for key, appending make() to the pool if there is none yet.
+            template<typename TKey, typename TPool, typename TFunc>
+            static uint32_t pooled(std::unordered_map<TKey, uint32_t>& indices, const TKey& key, TPool& pool, TFunc make)
+            {
+                auto res = indices.try_emplace(key, (uint32_t)pool.size());
+                if (res.second)
+                {
+                    pool.push_back(make());
+                }
+                return res.first->second;
+            }
+        public:
+            program() = default;
+
+            void emit(opkind kind, const sqf::runtime::instruction* source, uint32_t operand = 0)
+            {
+                m_ops.push_back({ kind, operand, source });
+            }
+            uint32_t constant(sqf::runtime::value value)
+            {
+                m_constants.push_back(std::move(value));
+                return (uint32_t)(m_constants.size() - 1);
+            }
+            uint32_t variable(std::string name, std::string key)
+            {
+                return pooled(m_variable_indices, name, m_variables, [&]() { return variable_operand{ name, std::move(key) }; });
+            }
+            /// <summary>
+            /// Returns the slot of the provided local variable, every variable of a program gets exactly one.
+            /// Frames cache the variable each slot resolved to (see sqf::runtime::context::find_local_slot),
+            /// private assignments bind the slot right away, so later accesses skip the lookup by name.
+            /// </summary>
+            uint32_t local(std::string name, std::string key)
+            {
+                return pooled(m_local_indices, key, m_locals, [&]() { return variable_operand{ std::move(name), key }; });
+            }
+            uint32_t nular(sqf::runtime::sqfop_id id, std::string name)
+            {
+                return pooled(m_nular_indices, id, m_nular_calls, [&]() { return nular_call{ id, std::move(name), {} }; });
+            }
+            uint32_t unary(sqf::runtime::sqfop_id id, std::string name)
+            {
+                return pooled(m_unary_indices, id, m_unary_calls, [&]() { return unary_call{ id, std::move(name), {} }; });
+            }
+            uint32_t binary(sqf::runtime::sqfop_id id, std::string name)
+            {
+                return pooled(m_binary_indices, id, m_binary_calls, [&]() { return binary_call{ id, std::move(name), {} }; });
+            }
+
+            const op& operator[](size_t index) const { return m_ops[index]; }
+            const sqf::runtime::value& constant_at(uint32_t index) const { return m_constants[index]; }
+            const variable_operand& variable_at(uint32_t index) const { return m_variables[index]; }
+            const variable_operand& local_at(uint32_t slot) const { return m_locals[slot]; }
+            const nular_call& nular_at(uint32_t index) const { return m_nular_calls[index]; }
+            const unary_call& unary_at(uint32_t index) const { return m_unary_calls[index]; }
+            const binary_call& binary_at(uint32_t index) const { return m_binary_calls[index]; }
+            size_t size() const { return m_ops.size(); }
+            bool empty() const { return m_ops.empty(); }
+        };
+    }
+}
@@ -0,0 +1,564 @@
+#include "confighost.h"
+#include "d_scalar.h"
+#include "d_string.h"
+#include "d_array.h"
+
+#include <ostream>
+#include <cstring>
+
+// Layout of an image (all integers in native byte order):
+//   header      magic, version, name count, container count, child count, value bytes, string bytes
+//   names       name count * { string offset, length }
+//   containers  container count * { name, logical parent, inherited parent, first child, child count, value offset }
+//   children    child count * { name, container id } (container id is invalid for deleted children)
+//   values      tagged values referenced by the containers
+//   strings     all names, back to back
+static const uint32_t image_magic = 0x43465153; // SQFC
+static const uint32_t image_version = 1;
+static const uint32_t image_invalid = ~(uint32_t)0;
+static const size_t image_max_depth = 256;
+
+enum class image_value : uint8_t
+{
+    none,
+    scalar,
+    string,
+    array
+};
+
+struct image_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t names;
+    uint32_t containers;
+    uint32_t children;
+    uint32_t value_bytes;
+    uint32_t string_bytes;
+};
+struct image_name
+{
+    uint32_t offset;
+    uint32_t length;
+};
+struct image_container
+{
+    uint32_t name;
+    uint32_t parent_logical;
+    uint32_t parent_inherited;
+    uint32_t children_begin;
+    uint32_t children_count;
+    uint32_t value;
+};
+struct image_child
+{
+    uint32_t name;
+    uint32_t id;
+};
+
+template<typename T>
+static void append_raw(std::string& out, const T& val)
+{
+    out.append(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+static uint32_t to_image_id(size_t id)
+{
+    return id == sqf::runtime::config::invalid_id ? image_invalid : static_cast<uint32_t>(id);
+}
+static size_t from_image_id(uint32_t id)
+{
+    return id == image_invalid ? sqf::runtime::config::invalid_id : static_cast<size_t>(id);
+}
+static void append_value(std::string& out, const sqf::runtime::value& val)
+{
+    if (val.is<sqf::runtime::t_scalar>())
+    {
+        out.push_back(static_cast<char>(image_value::scalar));
+        append_raw(out, val.data<sqf::types::d_scalar, float>());
+    }
+    else if (val.is<sqf::runtime::t_string>())
+    {
+        auto str = val.data<sqf::types::d_string, std::string>();
+        out.push_back(static_cast<char>(image_value::string));
+        append_raw(out, static_cast<uint32_t>(str.length()));
+        out.append(str);
+    }
+    else if (val.is<sqf::runtime::t_array>())
+    {
+        auto& values = val.data<sqf::types::d_array>()->view();
+        out.push_back(static_cast<char>(image_value::array));
+        append_raw(out, static_cast<uint32_t>(values.size()));
+        for (auto& it : values)
+        {
+            append_value(out, it);
+        }
+    }
+    else
+    {
+        out.push_back(static_cast<char>(image_value::none));
+    }
+}
+
+class image_reader
+{
+    std::string_view m_data;
+    size_t m_position;
+    bool m_failed;
+public:
+    image_reader(std::string_view data) : m_data(data), m_position(0), m_failed(false) {}
+    bool failed() const { return m_failed; }
+    size_t remaining() const { return m_data.length() - m_position; }
+    void seek(size_t position)
+    {
+        if (position > m_data.length())
+        {
+            m_failed = true;
+            return;
+        }
+        m_position = position;
+    }
+    std::string_view bytes(size_t length)
+    {
+        if (m_failed || remaining() < length)
+        {
+            m_failed = true;
+            return {};
+        }
+        auto view = m_data.substr(m_position, length);
+        m_position += length;
+        return view;
+    }
+    template<typename T>
+    T read()
+    {
+        T val{};
+        auto view = bytes(sizeof(T));
+        if (!m_failed)
+        {
+            std::memcpy(&val, view.data(), sizeof(T));
+        }
+        return val;
+    }
+    sqf::runtime::value read_value(size_t depth)
+    {
+        switch (static_cast<image_value>(read<uint8_t>()))
+        {
+        case image_value::none:
+            return {};
+        case image_value::scalar:
+            return std::make_shared<sqf::types::d_scalar>(read<float>());
+        case image_value::string:
+        {
+            auto length = read<uint32_t>();
+            return std::make_shared<sqf::types::d_string>(bytes(length));
+        }
+        case image_value::array:
+        {
+            auto count = read<uint32_t>();
+            if (depth >= image_max_depth || count > remaining())
+            { // Every value takes at least one byte
+                m_failed = true;
+                return {};
+            }
+            std::vector<sqf::runtime::value> values;
+            values.reserve(count);
+            for (uint32_t i = 0; i < count && !m_failed; i++)
+            {
+                values.push_back(read_value(depth + 1));
+            }
+            return std::make_shared<sqf::types::d_array>(std::move(values));
+        }
+        default:
+            m_failed = true;
+            return {};
+        }
+    }
+};
+
+void sqf::runtime::confighost::write_image(std::ostream& out) const
+{
+    // Names of deleted children are only known by their (lowercase) symbol
+    std::vector<std::string_view> symbol_names(symbol_count());
+    if (m_base)
+    {
+        for (auto& pair : m_base->m_symbols)
+        {
+            symbol_names[pair.second] = pair.first;
+        }
+    }
+    for (auto& pair : m_symbols)
+    {
+        symbol_names[pair.second] = pair.first;
+    }
+
+    std::string names;
+    std::string strings;
+    std::unordered_map<std::string_view, uint32_t> name_indices;
+    auto name_index = [&](std::string_view name) -> uint32_t {
+        auto res = name_indices.emplace(name, static_cast<uint32_t>(name_indices.size()));
+        if (res.second)
+        {
+            append_raw(names, image_name{ static_cast<uint32_t>(strings.length()), static_cast<uint32_t>(name.length()) });
+            strings.append(name);
+        }
+        return res.first->second;
+    };
+
+    std::string containers;
+    std::string children;
+    std::string values;
+    uint32_t child_count = 0;
+    for (size_t container_id = 0; container_id < container_count(); container_id++)
+    {
+        auto& container = container_at(container_id);
+        uint32_t value_offset = image_invalid;
+        if (!container.value.empty())
+        {
+            value_offset = static_cast<uint32_t>(values.length());
+            append_value(values, container.value);
+        }
+        append_raw(containers, image_container{
+            name_index(container.name),
+            to_image_id(container.id_parent_logical),
+            to_image_id(container.id_parent_inherited),
+            child_count,
+            static_cast<uint32_t>(container.m_children_vec.size()),
+            value_offset });
+        for (size_t i = 0; i < container.m_children_vec.size(); i++)
+        {
+            auto id = container.m_children_vec[i];
+            auto name = id == config::invalid_id ? symbol_names[container.m_children_symbols[i]] : container_at(id).name;
+            append_raw(children, image_child{ name_index(name), to_image_id(id) });
+        }
+        child_count += static_cast<uint32_t>(container.m_children_vec.size());
+    }
+
+    image_header header{
+        image_magic,
+        image_version,
+        static_cast<uint32_t>(name_indices.size()),
+        static_cast<uint32_t>(container_count()),
+        child_count,
+        static_cast<uint32_t>(values.length()),
+        static_cast<uint32_t>(strings.length()) };
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(names.data(), static_cast<std::streamsize>(names.length()));
+    out.write(containers.data(), static_cast<std::streamsize>(containers.length()));
+    out.write(children.data(), static_cast<std::streamsize>(children.length()));
+    out.write(values.data(), static_cast<std::streamsize>(values.length()));
+    out.write(strings.data(), static_cast<std::streamsize>(strings.length()));
+}
+
+bool sqf::runtime::confighost::read_image(std::string_view image, std::shared_ptr<const void> owner)
+{
+    if (m_base || m_containers.size() != 1 || m_containers.front().size() != 0)
+    {
+        return false;
+    }
+
+    image_reader reader(image);
+    auto header = reader.read<image_header>();
+    if (reader.failed() || header.magic != image_magic || header.version != image_version || header.containers == 0)
+    {
+        return false;
+    }
+    auto names_view = reader.bytes(sizeof(image_name) * static_cast<size_t>(header.names));
+    auto containers_view = reader.bytes(sizeof(image_container) * static_cast<size_t>(header.containers));
+    auto children_view = reader.bytes(sizeof(image_child) * static_cast<size_t>(header.children));
+    auto values_begin = image.length() - reader.remaining();
+    reader.bytes(header.value_bytes);
+    auto strings = reader.bytes(header.string_bytes);
+    if (reader.failed())
+    {
+        return false;
+    }
+
+    // Validate everything upfront, keeping the confighost untouched on malformed images
+    std::vector<std::string_view> names;
+    names.reserve(header.names);
+    for (uint32_t i = 0; i < header.names; i++)
+    {
+        image_name name;
+        std::memcpy(&name, names_view.data() + i * sizeof(image_name), sizeof(image_name));
+        if (name.offset > strings.length() || name.length > strings.length() - name.offset)
+        {
+            return false;
+        }
+        names.push_back(strings.substr(name.offset, name.length));
+    }
+    auto valid_id = [&header](uint32_t id) { return id == image_invalid || id < header.containers; };
+    std::vector<image_container> containers(header.containers);
+    std::memcpy(containers.data(), containers_view.data(), containers_view.length());
+    std::vector<image_child> children(header.children);
+    std::memcpy(children.data(), children_view.data(), children_view.length());
+    std::vector<sqf::runtime::value> values(header.containers);
+    for (size_t i = 0; i < containers.size(); i++)
+    {
+        auto& container = containers[i];
+        if (container.name >= header.names ||
+            !valid_id(container.parent_logical) ||
+            !valid_id(container.parent_inherited) ||
+            container.children_begin > header.children ||
+            container.children_count > header.children - container.children_begin)
+        {
+            return false;
+        }
+        if (container.value != image_invalid)
+        {
+            if (container.value >= header.value_bytes)
+            {
+                return false;
+            }
+            reader.seek(values_begin + container.value);
+            values[i] = reader.read_value(0);
+            if (reader.failed())
+            {
+                return false;
+            }
+        }
+    }
+    for (auto& child : children)
+    {
+        if (child.name >= header.names || !valid_id(child.id))
+        {
+            return false;
+        }
+    }
+
+    // Parent chains are walked without a bound later on, a cycle in either of them would never terminate
+    auto acyclic = [&containers](uint32_t image_container::* parent) -> bool
+    {
+        enum class mark : uint8_t { unvisited, visiting, done };
+        std::vector<mark> marks(containers.size(), mark::unvisited);
+        std::vector<uint32_t> path;
+        for (uint32_t i = 0; i < containers.size(); i++)
+        {
+            auto id = i;
+            while (id != image_invalid && marks[id] == mark::unvisited)
+            {
+                marks[id] = mark::visiting;
+                path.push_back(id);
+                id = containers[id].*parent;
+            }
+            if (id != image_invalid && marks[id] == mark::visiting)
+            {
+                return false;
+            }
+            for (auto visited : path)
+            {
+                marks[visited] = mark::done;
+            }
+            path.clear();
+        }
+        return true;
+    };
+    if (!acyclic(&image_container::parent_logical) || !acyclic(&image_container::parent_inherited))
+    {
+        return false;
+    }
+
+    // Names only get lowercased and hashed once per distinct name
+    std::vector<config::symbol> name_symbols;
+    name_symbols.reserve(names.size());
+    for (auto& name : names)
+    {
+        name = *m_name_lookup.insert(name).first;
+        name_symbols.push_back(intern_symbol(name));
+    }
+
+    m_containers.clear();
+    m_containers.reserve(containers.size());
+    m_children.reserve(children.size());
+    for (size_t i = 0; i < containers.size(); i++)
+    {
+        auto& image_entry = containers[i];
+        auto& container = m_containers.emplace_back(i, name_symbols[image_entry.name], names[image_entry.name]);
+        container.id_parent_logical = from_image_id(image_entry.parent_logical);
+        container.id_parent_inherited = from_image_id(image_entry.parent_inherited);
+        container.value = std::move(values[i]);
+        container.m_children_vec.reserve(image_entry.children_count);
+        container.m_children_symbols.reserve(image_entry.children_count);
+        for (uint32_t j = image_entry.children_begin; j < image_entry.children_begin + image_entry.children_count; j++)
+        {
+            auto name_symbol = name_symbols[children[j].name];
+            auto id = from_image_id(children[j].id);
+            container.m_children_vec.push_back(id);
+            container.m_children_symbols.push_back(name_symbol);
+            m_children.emplace(child_key(i, name_symbol), id);
+        }
+    }
+    m_image = std::move(owner);
+
+    inheritance_changed();
+    structure_changed(0);
+    if (m_resolve)
+    {
+        resolve();
+    }
+    return true;
+}
+
+// Confighosts using a snapshot copy its arrays concurrently (eg. getArray), which must not write to them
+static void share_arrays(sqf::runtime::config::container& container)
+{
+    auto arr = container.value.data_try<sqf::types::d_array>();
+    if (arr)
+    {
+        arr->share_deep();
+    }
+}
+
+std::shared_ptr<const sqf::runtime::confighost::snapshot> sqf::runtime::confighost::freeze()
+{
+    if (m_base && m_containers.empty() && m_overrides.empty() && m_children.empty() && m_symbols.empty())
+    {
+        return m_base;
+    }
+
+    if (m_base && m_base.use_count() == 1)
+    {
+        // Nobody else sees the snapshot, so only the changed and created containers have to move into it.
+        // Snapshots only ever get created as mutable objects (see below), the const merely protects shared ones.
+        auto& base = const_cast<snapshot&>(*m_base);
+        for (auto& pair : m_overrides)
+        {
+            share_arrays(pair.second);
+            base.m_containers[pair.first] = std::move(pair.second);
+        }
+        base.m_containers.reserve(container_count());
+        for (auto& container : m_containers)
+        {
+            share_arrays(container);
+            base.m_containers.push_back(std::move(container));
+        }
+        base.m_name_lookup.insert(m_name_lookup.begin(), m_name_lookup.end());
+        base.m_symbols.insert(m_symbols.begin(), m_symbols.end());
+        for (auto& pair : m_children)
+        {
+            base.m_children[pair.first] = pair.second;
+        }
+        base.m_names.push_back(std::move(m_names));
+
+        m_overrides.clear();
+        m_containers.clear();
+        m_names.clear();
+        m_name_lookup.clear();
+        m_symbols.clear();
+        m_children.clear();
+        // Ids stay the same, so the caches remain valid
+        return m_base;
+    }
+
+    auto frozen = std::make_shared<snapshot>();
+    if (m_base)
+    {
+        // Names and the image stay in their previous snapshot, only the containers are copied
+        frozen->m_containers.reserve(container_count());
+        for (size_t id = 0; id < base_size(); id++)
+        {
+            frozen->m_containers.push_back(copy_container(container_at(id)));
+        }
+        for (auto& container : m_containers)
+        {
+            frozen->m_containers.push_back(std::move(container));
+        }
+        frozen->m_name_lookup = m_base->m_name_lookup;
+        frozen->m_name_lookup.insert(m_name_lookup.begin(), m_name_lookup.end());
+        frozen->m_symbols = m_base->m_symbols;
+        frozen->m_symbols.insert(m_symbols.begin(), m_symbols.end());
+        frozen->m_children = m_base->m_children;
+        for (auto& pair : m_children)
+        {
+            frozen->m_children[pair.first] = pair.second;
+        }
+        frozen->m_previous = std::move(m_base);
+    }
+    else
+    {
+        frozen->m_containers = std::move(m_containers);
+        frozen->m_name_lookup = std::move(m_name_lookup);
+        frozen->m_symbols = std::move(m_symbols);
+        frozen->m_children = std::move(m_children);
+    }
+    // Moving the deque keeps its elements in place, so the names referenced by the containers stay valid
+    frozen->m_names.push_back(std::move(m_names));
+    frozen->m_image = std::move(m_image);
+    for (auto& container : frozen->m_containers)
+    {
+        share_arrays(container);
+    }
+
+    m_base = std::move(frozen);
+    m_overrides.clear();
+    m_containers.clear();
+    m_names.clear();
+    m_name_lookup.clear();
+    m_image.reset();
+    m_symbols.clear();
+    m_children.clear();
+    // Ids stay the same, so the caches remain valid
+    return m_base;
+}
+
+void sqf::runtime::confighost::rollback_transaction()
+{
+    if (!m_transaction)
+    {
+        return;
+    }
+    auto journal = std::move(*m_transaction);
+    m_transaction.reset();
+
+    m_containers.erase(m_containers.begin() + static_cast<std::ptrdiff_t>(journal.containers - base_size()), m_containers.end());
+    for (auto& pair : journal.containers_before)
+    {
+        mutable_container(pair.first) = std::move(pair.second);
+    }
+    for (auto& pair : journal.children_before)
+    {
+        if (pair.second.has_value())
+        {
+            m_children[pair.first] = *pair.second;
+        }
+        else
+        {
+            m_children.erase(pair.first);
+        }
+    }
+
+    m_generation++;
+    m_lookup_cache.clear();
+    m_resolved.clear();
+    m_inheritors.clear();
+    m_inherited_names.clear();
+    if (m_resolve)
+    {
+        resolve();
+    }
+}
+
+void sqf::runtime::confighost::use_snapshot(std::shared_ptr<const snapshot> base)
+{
+    if (!base || base->m_containers.empty())
+    {
+        return;
+    }
+    m_base = std::move(base);
+    m_overrides.clear();
+    m_containers.clear();
+    m_names.clear();
+    m_name_lookup.clear();
+    m_image.reset();
+    m_symbols.clear();
+    m_children.clear();
+
+    m_generation++;
+    m_lookup_cache.clear();
+    m_resolved.clear();
+    m_inheritors.clear();
+    m_inherited_names.clear();
+    if (m_resolve)
+    {
+        resolve();
+    }
+}
@@ -6,6 +6,14 @@
 #include <string_view>
 #include <optional>
 #include <unordered_map>
+#include <unordered_set>
+#include <deque>
+#include <memory>
+#include <iosfwd>
+#include <algorithm>
+#include <iterator>
+#include <cctype>
+#include <cstdint>
 
 namespace sqf::runtime
 {
@@ -19,62 +27,53 @@ namespace sqf::runtime
         friend class confignav;
     public:
         static const size_t invalid_id = ~((size_t)0);
+        // Case-insensitive id of a config name (see confighost::symbol_of).
+        using symbol = uint32_t;
         struct container
         {
         private:
+            friend class ::sqf::runtime::confighost;
+            // Children in definition order. The name lookup is done via the confighost.
             std::vector<size_t> m_children_vec;
-            std::unordered_map<std::string, size_t> m_children;
+            // Name symbols of m_children_vec (kept as deleted children are stored as config::invalid_id).
+            std::vector<symbol> m_children_symbols;
         public:
-            using iterator = std::unordered_map<std::string, size_t>::iterator;
             sqf::runtime::value value;
             size_t id;
             size_t id_parent_logical;
             size_t id_parent_inherited;
-            std::string name;
+            symbol name_symbol;
+            // Name as written in the config, pointing into the name pool of the owning confighost.
+            std::string_view name;
 
-            container(size_t id, std::string name) noexcept : m_children_vec(), m_children(), id(id), id_parent_logical(invalid_id), id_parent_inherited(invalid_id), name(name) {}
-            container() noexcept : m_children_vec(), m_children(), id(invalid_id), id_parent_logical(invalid_id), id_parent_inherited(invalid_id), name({}) {}
+            container(size_t id, symbol name_symbol, std::string_view name) noexcept : m_children_vec(), m_children_symbols(), id(id), id_parent_logical(invalid_id), id_parent_inherited(invalid_id), name_symbol(name_symbol), name(name) {}
+            container() noexcept : m_children_vec(), m_children_symbols(), id(invalid_id), id_parent_logical(invalid_id), id_parent_inherited(invalid_id), name_symbol(~(symbol)0), name() {}
             container(const container& copy) = delete;
             container(container&& move) noexcept :
                 m_children_vec(std::move(move.m_children_vec)),
-                m_children(std::move(move.m_children)),
+                m_children_symbols(std::move(move.m_children_symbols)),
                 value(std::move(move.value)),
                 id(move.id),
                 id_parent_logical(move.id_parent_logical),
                 id_parent_inherited(move.id_parent_inherited),
-                name(std::move(move.name)) {}
+                name_symbol(move.name_symbol),
+                name(move.name) {}
+            container& operator=(container&& move) noexcept
+            {
+                m_children_vec = std::move(move.m_children_vec);
+                m_children_symbols = std::move(move.m_children_symbols);
+                value = std::move(move.value);
+                id = move.id;
+                id_parent_logical = move.id_parent_logical;
+                id_parent_inherited = move.id_parent_inherited;
+                name_symbol = move.name_symbol;
+                name = move.name;
+                return *this;
+            }
 
             size_t size() const { return m_children_vec.size(); }
-            size_t operator[] (std::string index) { return m_children[index]; }
-            size_t operator[] (std::string index) const { return m_children.at(index); }
             size_t operator[] (size_t index) { return m_children_vec[index]; }
             size_t operator[] (size_t index) const { return m_children_vec[index]; }
-            iterator begin() noexcept { return m_children.begin(); }
-            iterator end() noexcept { return m_children.end(); }
-            iterator find(std::string index) { return m_children.find(index); }
-            void push_back(std::string key, size_t target_id)
-            {
-                auto res = m_children.find(key);
-                if (res == m_children.end())
-                {
-                    m_children_vec.push_back(target_id);
-                }
-                else if (res->second == target_id)
-                {
-                    return;
-                }
-                else
-                {
-                    for (auto& it : m_children_vec)
-                    {
-                        if (it == res->second)
-                        {
-                            it = target_id;
-                        }
-                    }
-                }
-                m_children[key] = target_id;
-            }
         };
 
     private:
@@ -107,15 +106,512 @@ namespace sqf::runtime
         friend class config;
     public:
         using config_iterator = std::vector<config>::iterator;
+
+        /// <summary>
+        /// Immutable state of a confighost, created via freeze.
+        /// Multiple confighosts (eg. of different runtimes) may reference the same snapshot concurrently,
+        /// each keeping its own changes in an overlay on top of it.
+        /// </summary>
+        class snapshot
+        {
+            friend class confighost;
+            std::vector<config::container> m_containers;
+            // Name pools of the confighosts frozen into this snapshot (moved in as a whole, keeping the names in place).
+            std::deque<std::deque<std::string>> m_names;
+            std::unordered_set<std::string_view> m_name_lookup;
+            std::shared_ptr<const void> m_image;
+            std::unordered_map<std::string, config::symbol> m_symbols;
+            std::unordered_map<uint64_t, size_t> m_children;
+            // Snapshot this one got created from, names may still point into it.
+            std::shared_ptr<const snapshot> m_previous;
+        public:
+            size_t size() const { return m_containers.size(); }
+        };
     private:
+        // Shared immutable state, may be empty. All other members hold the changes made on top of it:
+        // Containers created on top of the snapshot live in m_containers (at id - base_size()),
+        // containers of the snapshot are copied into m_overrides before being modified.
+        std::shared_ptr<const snapshot> m_base;
+        std::unordered_map<size_t, config::container> m_overrides;
         std::vector<config::container> m_containers;
 
+        // Pool of all container names as written (deque as containers keep views into it).
+        std::deque<std::string> m_names;
+        std::unordered_set<std::string_view> m_name_lookup;
+        // Keeps the memory of an image loaded via read_image alive, as container names point into it.
+        std::shared_ptr<const void> m_image;
+        // Case-insensitive symbols of all container names (keys are lowercase).
+        std::unordered_map<std::string, config::symbol> m_symbols;
+        // Children of all containers, keyed by child_key(parent id, name symbol).
+        // A child mapped to config::invalid_id got deleted (masking inherited entries of the same name).
+        std::unordered_map<uint64_t, size_t> m_children;
+
+        // Bumped on every structural change (created/deleted children, changed inherited parents).
+        uint64_t m_generation = 0;
+        // Memoized results of confignav::lookup_in_inherited, keyed by child_key(container id, name symbol).
+        // Holds config::invalid_id for names that did not resolve. Cleared whenever the generation changes.
+        std::unordered_map<uint64_t, size_t> m_lookup_cache;
+
+        // Flattened view enabled via resolve().
+        // m_resolved[id] holds all entries visible from the container (own and inherited), sorted by name symbol.
+        // An empty optional means "not yet computed". Structural changes reset the affected containers and their inheritors.
+        bool m_resolve = false;
+        std::vector<std::optional<std::vector<std::pair<config::symbol, size_t>>>> m_resolved;
+        // Containers directly inheriting from a container. Only maintained while resolved.
+        std::vector<std::vector<size_t>> m_inheritors;
+
+        // Inheritance closure cache used by has_inherited_with_name.
+        // m_inherited_names[id] holds the sorted name symbols of the container and all of its inherited parents.
+        // An empty vector means "not yet computed".
+        // Created containers do not affect existing entries, changing an inherited parent clears the cache.
+        std::vector<std::vector<config::symbol>> m_inherited_names;
+
+        // Undo journal of the open transaction (see begin_transaction).
+        struct transaction
+        {
+            // Container count when the transaction was started, later containers get dropped on rollback.
+            size_t containers;
+            // Previous state of the containers modified during the transaction.
+            std::unordered_map<size_t, config::container> containers_before;
+            // Previous entries of m_children, empty optionals for entries not existing before.
+            std::unordered_map<uint64_t, std::optional<size_t>> children_before;
+        };
+        std::optional<transaction> m_transaction;
+
+        static std::string lowercase(std::string_view name)
+        {
+            std::string lower(name);
+            std::transform(lower.begin(), lower.end(), lower.begin(), [](char c) { return (char)std::tolower((int)c); });
+            return lower;
+        }
+        static uint64_t child_key(size_t parent, config::symbol name_symbol) { return (static_cast<uint64_t>(parent) << 32) | name_symbol; }
+        static config::container copy_container(const config::container& source)
+        {
+            config::container copy(source.id, source.name_symbol, source.name);
+            copy.m_children_vec = source.m_children_vec;
+            copy.m_children_symbols = source.m_children_symbols;
+            copy.value = source.value;
+            copy.id_parent_logical = source.id_parent_logical;
+            copy.id_parent_inherited = source.id_parent_inherited;
+            return copy;
+        }
+
+        size_t base_size() const { return m_base ? m_base->m_containers.size() : 0; }
+        size_t container_count() const { return base_size() + m_containers.size(); }
+        const config::container& container_at(size_t id) const
+        {
+            auto base = base_size();
+            if (id >= base)
+            {
+                return m_containers.at(id - base);
+            }
+            auto res = m_overrides.find(id);
+            return res == m_overrides.end() ? m_base->m_containers[id] : res->second;
+        }
+        // Returns the container for modification, copying it out of the snapshot first if needed.
+        config::container& mutable_container(size_t id)
+        {
+            if (m_transaction && id < m_transaction->containers && m_transaction->containers_before.find(id) == m_transaction->containers_before.end())
+            {
+                m_transaction->containers_before.emplace(id, copy_container(container_at(id)));
+            }
+            auto base = base_size();
+            if (id >= base)
+            {
+                return m_containers.at(id - base);
+            }
+            auto res = m_overrides.find(id);
+            if (res == m_overrides.end())
+            {
+                res = m_overrides.emplace(id, copy_container(m_base->m_containers[id])).first;
+            }
+            return res->second;
+        }
+
+        std::string_view intern_name(std::string_view name)
+        {
+            if (m_base)
+            {
+                auto res = m_base->m_name_lookup.find(name);
+                if (res != m_base->m_name_lookup.end())
+                {
+                    return *res;
+                }
+            }
+            auto res = m_name_lookup.find(name);
+            if (res != m_name_lookup.end())
+            {
+                return *res;
+            }
+            std::string_view pooled = m_names.emplace_back(name);
+            m_name_lookup.insert(pooled);
+            return pooled;
+        }
+        std::optional<config::symbol> find_symbol(const std::string& lower) const
+        {
+            if (m_base)
+            {
+                auto res = m_base->m_symbols.find(lower);
+                if (res != m_base->m_symbols.end())
+                {
+                    return res->second;
+                }
+            }
+            auto res = m_symbols.find(lower);
+            if (res == m_symbols.end())
+            {
+                return {};
+            }
+            return res->second;
+        }
+        size_t symbol_count() const { return (m_base ? m_base->m_symbols.size() : 0) + m_symbols.size(); }
+        config::symbol intern_symbol(std::string_view name)
+        {
+            auto lower = lowercase(name);
+            auto res = find_symbol(lower);
+            if (res.has_value())
+            {
+                return *res;
+            }
+            auto name_symbol = static_cast<config::symbol>(symbol_count());
+            m_symbols.emplace(std::move(lower), name_symbol);
+            return name_symbol;
+        }
+        size_t create_container(std::string_view name)
+        {
+            auto id = container_count();
+            m_containers.emplace_back(id, intern_symbol(name), intern_name(name));
+            return id;
+        }
+        std::optional<size_t> find_child(size_t parent, config::symbol name_symbol) const
+        {
+            auto key = child_key(parent, name_symbol);
+            auto res = m_children.find(key);
+            if (res != m_children.end())
+            {
+                return res->second;
+            }
+            if (m_base && parent < m_base->m_containers.size())
+            {
+                auto base_res = m_base->m_children.find(key);
+                if (base_res != m_base->m_children.end())
+                {
+                    return base_res->second;
+                }
+            }
+            return {};
+        }
+        void set_child(size_t parent, config::symbol name_symbol, size_t target_id)
+        {
+            if (m_transaction)
+            {
+                auto key = child_key(parent, name_symbol);
+                if (m_transaction->children_before.find(key) == m_transaction->children_before.end())
+                {
+                    auto res = m_children.find(key);
+                    m_transaction->children_before.emplace(key, res == m_children.end() ? std::optional<size_t>() : res->second);
+                }
+            }
+            auto existing = find_child(parent, name_symbol);
+            if (!existing.has_value())
+            {
+                auto& container = mutable_container(parent);
+                container.m_children_vec.push_back(target_id);
+                container.m_children_symbols.push_back(name_symbol);
+                m_children[child_key(parent, name_symbol)] = target_id;
+                structure_changed(parent);
+            }
+            else if (*existing != target_id)
+            {
+                auto& container = mutable_container(parent);
+                auto index = std::find(container.m_children_symbols.begin(), container.m_children_symbols.end(), name_symbol) - container.m_children_symbols.begin();
+                container.m_children_vec[index] = target_id;
+                m_children[child_key(parent, name_symbol)] = target_id;
+                structure_changed(parent);
+            }
+        }
+        void set_parent_inherited(size_t id, size_t parent)
+        {
+            if (container_at(id).id_parent_inherited == parent)
+            {
+                return;
+            }
+            auto& container = mutable_container(id);
+            if (m_resolve)
+            {
+                if (container.id_parent_inherited < m_inheritors.size())
+                {
+                    auto& inheritors = m_inheritors[container.id_parent_inherited];
+                    inheritors.erase(std::remove(inheritors.begin(), inheritors.end(), id), inheritors.end());
+                }
+                if (parent != config::invalid_id)
+                {
+                    if (m_inheritors.size() <= parent)
+                    {
+                        m_inheritors.resize(container_count());
+                    }
+                    m_inheritors[parent].push_back(id);
+                }
+            }
+            container.id_parent_inherited = parent;
+            structure_changed(id);
+        }
+        void structure_changed(size_t id)
+        {
+            m_generation++;
+            if (!m_lookup_cache.empty())
+            { // Loading configs creates lots of containers, keep those changes cheap
+                m_lookup_cache.clear();
+            }
+            if (m_resolve)
+            {
+                unresolve(id);
+            }
+        }
+        // Resets the flattened view of the container and everything inheriting from it.
+        void unresolve(size_t id)
+        {
+            // Inheritors of an unresolved container are unresolved too, allowing to stop early (and on cyclic inheritance).
+            std::vector<size_t> pending = { id };
+            while (!pending.empty())
+            {
+                auto index = pending.back();
+                pending.pop_back();
+                if (index >= m_resolved.size() || !m_resolved[index].has_value())
+                {
+                    continue;
+                }
+                m_resolved[index].reset();
+                if (index < m_inheritors.size())
+                {
+                    pending.insert(pending.end(), m_inheritors[index].begin(), m_inheritors[index].end());
+                }
+            }
+        }
+        const std::vector<std::pair<config::symbol, size_t>>& resolved_entries(size_t id)
+        {
+            if (m_resolved.size() < container_count())
+            {
+                m_resolved.resize(container_count());
+            }
+            if (m_resolved[id].has_value())
+            {
+                return *m_resolved[id];
+            }
+
+            // Same scheme as inherited_names: collect the unresolved chain, then walk back down.
+            std::vector<size_t> chain;
+            size_t index = id;
+            while (index != config::invalid_id && !m_resolved[index].has_value() && chain.size() < container_count())
+            {
+                chain.push_back(index);
+                index = container_at(index).id_parent_inherited;
+            }
+            std::vector<std::pair<config::symbol, size_t>> entries;
+            if (index != config::invalid_id && m_resolved[index].has_value())
+            {
+                entries = *m_resolved[index];
+            }
+            auto by_symbol = [](const std::pair<config::symbol, size_t>& l, const std::pair<config::symbol, size_t>& r) { return l.first < r.first; };
+            for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+            {
+                auto& container = container_at(*it);
+                std::vector<std::pair<config::symbol, size_t>> own;
+                own.reserve(container.m_children_vec.size());
+                for (size_t i = 0; i < container.m_children_vec.size(); i++)
+                {
+                    own.emplace_back(container.m_children_symbols[i], container.m_children_vec[i]);
+                }
+                std::sort(own.begin(), own.end(), by_symbol);
+
+                // Own entries take precedence over inherited ones (set_union prefers the first range)
+                std::vector<std::pair<config::symbol, size_t>> merged;
+                merged.reserve(own.size() + entries.size());
+                std::set_union(own.begin(), own.end(), entries.begin(), entries.end(), std::back_inserter(merged), by_symbol);
+                entries = std::move(merged);
+                m_resolved[*it] = entries;
+            }
+            return *m_resolved[id];
+        }
+
+        const std::vector<config::symbol>& inherited_names(size_t id)
+        {
+            if (m_inherited_names.size() < container_count())
+            {
+                m_inherited_names.resize(container_count());
+            }
+            if (!m_inherited_names[id].empty())
+            {
+                return m_inherited_names[id];
+            }
+
+            // Collect the chain up to the first container with a known closure.
+            // The chain length is bound by the container count to not hang on (invalid) cyclic inheritance.
+            std::vector<size_t> chain;
+            size_t index = id;
+            while (index != config::invalid_id && m_inherited_names[index].empty() && chain.size() < container_count())
+            {
+                chain.push_back(index);
+                index = container_at(index).id_parent_inherited;
+            }
+            std::vector<config::symbol> names;
+            if (index != config::invalid_id && !m_inherited_names[index].empty())
+            {
+                names = m_inherited_names[index];
+            }
+            // Walk back down, each closure being the one of its parent plus its own name.
+            for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+            {
+                auto name = container_at(*it).name_symbol;
+                auto pos = std::lower_bound(names.begin(), names.end(), name);
+                if (pos == names.end() || *pos != name)
+                {
+                    names.insert(pos, name);
+                }
+                m_inherited_names[*it] = names;
+            }
+            return m_inherited_names[id];
+        }
+        void inheritance_changed() { m_inherited_names.clear(); }
+
     public:
         confignav root();
         confighost(const confighost& copy) = delete;
         confighost()
         {
-            m_containers.emplace_back(0, "config/bin");
+            create_container("config/bin");
+        }
+
+        /// <summary>
+        /// Materializes a flattened view of all containers, holding every entry visible from a container
+        /// including the inherited ones. Lookups via confignav::lookup_in_inherited become a single search.
+        /// Meant to be called once after loading. Later changes (eg. configParse__) keep the view up to date
+        /// by recomputing the affected containers lazily.
+        /// Costs memory proportional to the inherited entries of all containers.
+        /// </summary>
+        void resolve()
+        {
+            m_resolve = true;
+            m_inheritors.assign(container_count(), {});
+            for (size_t id = 0; id < container_count(); id++)
+            {
+                auto parent = container_at(id).id_parent_inherited;
+                if (parent != config::invalid_id)
+                {
+                    m_inheritors[parent].push_back(id);
+                }
+            }
+            m_resolved.assign(container_count(), {});
+            for (size_t id = 0; id < container_count(); id++)
+            {
+                resolved_entries(id);
+            }
+        }
+        /// <summary>
+        /// Drops the flattened view (see resolve), freeing its memory. Lookups walk the inheritance again.
+        /// </summary>
+        void unresolve_all()
+        {
+            m_resolve = false;
+            m_resolved = {};
+            m_inheritors = {};
+        }
+        bool resolved() const { return m_resolve; }
+
+        /// <summary>
+        /// Moves the whole config tree into an immutable snapshot, which then serves as the base of this confighost.
+        /// The snapshot can be handed to other confighosts via use_snapshot, sharing the memory of the tree between all of them.
+        /// Changes made afterwards (eg. configParse__) are kept per confighost, copying only the affected containers.
+        /// Freezing a confighost that already is based on a snapshot moves its changes into that snapshot,
+        /// unless the snapshot is used elsewhere (eg. by other confighosts), in which case a new one is created.
+        /// </summary>
+        std::shared_ptr<const snapshot> freeze();
+
+        /// <summary>
+        /// Discards the current config tree and uses the provided snapshot as base instead.
+        /// The flattened view (see resolve) is not part of the snapshot and gets recomputed if enabled.
+        /// </summary>
+        void use_snapshot(std::shared_ptr<const snapshot> base);
+
+        /// <summary>
+        /// Returns the snapshot this confighost is based on, or an empty pointer.
+        /// </summary>
+        std::shared_ptr<const snapshot> base() const { return m_base; }
+
+        /// <summary>
+        /// Writes the whole config tree into a compact binary image (string pool, container table and values),
+        /// allowing to skip preprocessing and parsing when loading the same configs again via read_image.
+        /// The image uses the native byte order and is meant as a local cache only.
+        /// </summary>
+        void write_image(std::ostream& out) const;
+
+        /// <summary>
+        /// Loads a binary image created via write_image into this confighost, which has to be empty.
+        /// Container names are not copied but point into the image, hence owner has to keep the image memory alive.
+        /// </summary>
+        /// <returns>false if the image is malformed or the confighost is not empty. The confighost is left unchanged in that case.</returns>
+        bool read_image(std::string_view image, std::shared_ptr<const void> owner);
+
+        /// <summary>
+        /// Starts recording all changes made to the config tree, allowing to undo them via rollback_transaction.
+        /// Used to not leave partially applied configs behind (eg. on syntax errors). Transactions do not nest.
+        /// </summary>
+        /// <returns>false if a transaction is open already.</returns>
+        bool begin_transaction()
+        {
+            if (m_transaction)
+            {
+                return false;
+            }
+            m_transaction.emplace();
+            m_transaction->containers = container_count();
+            return true;
+        }
+
+        /// <summary>
+        /// Keeps all changes made since begin_transaction.
+        /// </summary>
+        void commit_transaction() { m_transaction.reset(); }
+
+        /// <summary>
+        /// Undoes all changes made since begin_transaction, restoring the config tree.
+        /// Names interned in the meantime are kept, they are not visible via the tree.
+        /// </summary>
+        void rollback_transaction();
+
+        /// <summary>
+        /// Returns the current generation of the config tree.
+        /// Changes whenever a lookup might resolve differently, allowing to cache lookup results externally.
+        /// </summary>
+        uint64_t generation() const { return m_generation; }
+
+        /// <summary>
+        /// Returns the symbol of the provided (case-insensitive) name, or an empty optional if no container carries it.
+        /// Allows to resolve names once when checking many containers against them.
+        /// </summary>
+        std::optional<config::symbol> symbol_of(std::string_view name) const
+        {
+            return find_symbol(lowercase(name));
+        }
+
+        /// <summary>
+        /// Checks whether the container or any of its inherited parents carries the name with the provided symbol.
+        /// Backed by a per-container cache of the inheritance closure, making repeated checks
+        /// a binary search over a handful of symbols instead of walking the inheritance chain.
+        /// </summary>
+        bool has_inherited_with_name(size_t id, config::symbol name_symbol)
+        {
+            if (id == config::invalid_id)
+            {
+                return false;
+            }
+            auto& names = inherited_names(id);
+            return std::binary_search(names.begin(), names.end(), name_symbol);
+        }
+        bool has_inherited_with_name(size_t id, std::string_view name)
+        {
+            auto res = symbol_of(name);
+            return res.has_value() && has_inherited_with_name(id, *res);
         }
     };
     class confignav
@@ -151,7 +647,7 @@ namespace sqf::runtime
             {
                 while (m_id != config::invalid_id)
                 {
-                    auto& container = m_confighost.m_containers[m_id];
+                    auto& container = m_confighost.container_at(m_id);
                     if (container.size() != m_index)
                     {
                         m_index++;
@@ -177,9 +673,9 @@ namespace sqf::runtime
             bool operator!=(iterator_base<recursive> other) const { return !(*this == other); }
             value_type operator*()
             {
-                auto& container = m_confighost.m_containers[m_id];
+                auto& container = m_confighost.container_at(m_id);
                 auto actual_index = container[m_index];
-                return m_confighost.m_containers[actual_index];
+                return m_confighost.container_at(actual_index);
             }
         };
         using iterator = iterator_base<false>;
@@ -202,7 +698,7 @@ namespace sqf::runtime
         {
             if (!empty())
             {
-                return &*(m_confighost.m_containers.begin() + m_index);
+                return &m_confighost.container_at(m_index);
             }
             return {};
         }
@@ -210,18 +706,18 @@ namespace sqf::runtime
         {
             if (!empty())
             {
-                return { m_confighost.m_containers.at(m_index) };
+                return { m_confighost.container_at(m_index) };
             }
             return {};
         }
         operator config() const { return **this; }
-        confignav operator/(std::string target) const { return lookup_in_inherited(target); }
+        confignav operator/(std::string_view target) const { return lookup_in_inherited(target); }
         confignav operator/(size_t index) const { return at(index); }
         confignav at(size_t index) const
         {
             if (!empty())
             {
-                auto& container = m_confighost.m_containers.at(index);
+                auto& container = m_confighost.container_at(index);
                 if (index < container.size())
                 {
                     return { m_confighost, container[index] };
@@ -229,64 +725,83 @@ namespace sqf::runtime
             }
             return { m_confighost, config::invalid_id };
         }
-        confignav lookup_in_inherited(std::string target) const
+        confignav lookup_in_inherited(std::string_view target) const
         {
+            auto name_symbol = m_confighost.symbol_of(target);
+            if (!name_symbol.has_value())
+            { // No container carries that name
+                return { m_confighost, config::invalid_id };
+            }
+            if (empty())
+            {
+                return { m_confighost, config::invalid_id };
+            }
+            if (m_confighost.m_resolve)
+            {
+                auto& entries = m_confighost.resolved_entries(m_index);
+                auto res = std::lower_bound(entries.begin(), entries.end(), *name_symbol,
+                    [](const std::pair<config::symbol, size_t>& entry, config::symbol name_symbol) { return entry.first < name_symbol; });
+                return { m_confighost, res != entries.end() && res->first == *name_symbol ? res->second : config::invalid_id };
+            }
+            auto key = confighost::child_key(m_index, *name_symbol);
+            auto cached = m_confighost.m_lookup_cache.find(key);
+            if (cached != m_confighost.m_lookup_cache.end())
+            {
+                return { m_confighost, cached->second };
+            }
+
+            size_t result = config::invalid_id;
             size_t index = m_index;
             while (index != config::invalid_id)
             {
-                auto& container = m_confighost.m_containers.at(index);
-
-                auto res = container.find(target);
-                if (res != container.end())
+                auto res = m_confighost.find_child(index, *name_symbol);
+                if (res.has_value())
                 {
-                    return { m_confighost, res->second };
+                    result = *res;
+                    break;
                 }
                 else
                 {
-                    index = container.id_parent_inherited;
+                    index = m_confighost.container_at(index).id_parent_inherited;
                 }
             }
-            return { m_confighost, config::invalid_id };
+            m_confighost.m_lookup_cache.emplace(key, result);
+            return { m_confighost, result };
         }
-        confignav lookup_in_logical(std::string target) const
+        confignav lookup_in_logical(std::string_view target) const
         {
+            auto name_symbol = m_confighost.symbol_of(target);
+            if (!name_symbol.has_value())
+            { // No container carries that name
+                return { m_confighost, config::invalid_id };
+            }
             size_t index = m_index;
             while (index != config::invalid_id)
             {
-                auto& container = m_confighost.m_containers.at(index);
-
-                auto res = container.find(target);
-                if (res != container.end())
+                auto res = m_confighost.find_child(index, *name_symbol);
+                if (res.has_value())
                 {
-                    return { m_confighost, res->second };
+                    return { m_confighost, *res };
                 }
                 else
                 {
-                    index = container.id_parent_logical;
+                    index = m_confighost.container_at(index).id_parent_logical;
                 }
             }
             return { m_confighost, config::invalid_id };
         }
         confignav append_or_replace(std::string_view target, std::string_view inherited = {}) const
-        {
-            std::string s_target = { target.data(), target.length() };
-            std::string s_inherited = { inherited.data(), inherited.length() };
-            return append_or_replace(s_target, s_inherited);
-        }
-        confignav append_or_replace(std::string target, std::string inherited = {}) const
         {
             if (!empty())
             {
-                // get config container from master-register
-                auto& container = m_confighost.m_containers.at(m_index);
-
-
                 // Find the targeted config ...
-                auto find_res = container.find(target);
-                if (find_res == container.end())
-                { // ... not found
+                auto name_symbol = m_confighost.intern_symbol(target);
+                auto find_res = m_confighost.find_child(m_index, name_symbol);
+                if (!find_res.has_value() || *find_res == config::invalid_id)
+                { // ... not found (or deleted previously)
                     // Create new container
-                    auto& created = m_confighost.m_containers.emplace_back(m_confighost.m_containers.size(), target); // container might be invalidated here due to m_containers resizing.
+                    auto created_id = m_confighost.create_container(target);
+                    auto& created = m_confighost.mutable_container(created_id); // references into m_containers are invalidated by further containers being created.
 
                     // Set logical parent to current container
                     created.id_parent_logical = m_index;
@@ -298,26 +813,31 @@ namespace sqf::runtime
                         auto nav = lookup_in_logical(inherited);
 
                         // and set it as parent
-                        created.id_parent_inherited = nav.m_index; // index is invalid if parent was not found
+                        m_confighost.set_parent_inherited(created_id, nav.m_index); // index is invalid if parent was not found
                     }
+                    // No inheritance_changed() needed, existing containers cannot inherit from the created one yet
 
                     // Add created container as child to parent container
-                    m_confighost.m_containers.at(m_index).push_back(target, created.id);
+                    m_confighost.set_child(m_index, name_symbol, created_id);
 
                     // Return created container as confignav
-                    return { m_confighost, created.id };
+                    return { m_confighost, created_id };
                 }
                 else
                 { // ... found
                     // Receive existing container
-                    auto& replaced = m_confighost.m_containers[find_res->second];
+                    auto& replaced = m_confighost.container_at(*find_res);
 
                     // Check if inherited is empty
                     if (!inherited.empty())
                     { // it is not
                         // Lookup inherited node and replace it
                         auto nav = lookup_in_logical(inherited);
-                        replaced.id_parent_inherited = nav.m_index;
+                        if (replaced.id_parent_inherited != nav.m_index)
+                        {
+                            m_confighost.set_parent_inherited(replaced.id, nav.m_index);
+                            m_confighost.inheritance_changed();
+                        }
                     }
 
                     // Return found container as confignav
@@ -327,44 +847,33 @@ namespace sqf::runtime
             return { m_confighost, config::invalid_id };
         }
         void delete_inherited_or_replace(std::string_view target) const
-        {
-            std::string s_target = { target.data(), target.length() };
-            delete_inherited_or_replace(s_target);
-        }
-        void delete_inherited_or_replace(std::string target) const
         {
             if (!empty())
             {
-                auto& container = m_confighost.m_containers.at(m_index);
-                container.push_back(target, config::invalid_id);
+                m_confighost.set_child(m_index, m_confighost.intern_symbol(target), config::invalid_id);
             }
         }
-        bool has_inherited_with_name(std::string target) const
+        bool has_inherited_with_name(std::string_view target) const
         {
-            size_t index = m_index;
-            while (index != config::invalid_id)
-            {
-                auto& container = m_confighost.m_containers.at(index);
-
-                if (container.name == target)
-                {
-                    return true;
-                }
-                else
-                {
-                    index = container.id_parent_inherited;
-                }
-            }
-            return false;
+            return m_confighost.has_inherited_with_name(m_index, target);
         }
-        bool has_logical_with_name(std::string target) const
+        bool has_inherited_with_name(config::symbol name_symbol) const
         {
+            return m_confighost.has_inherited_with_name(m_index, name_symbol);
+        }
+        bool has_logical_with_name(std::string_view target) const
+        {
+            auto name_symbol = m_confighost.symbol_of(target);
+            if (!name_symbol.has_value())
+            { // No container carries that name
+                return false;
+            }
             size_t index = m_index;
             while (index != config::invalid_id)
             {
-                auto& container = m_confighost.m_containers.at(index);
+                auto& container = m_confighost.container_at(index);
 
-                if (container.name == target)
+                if (container.name_symbol == *name_symbol)
                 {
                     return true;
                 }
@@ -381,7 +890,7 @@ namespace sqf::runtime
             if (!empty())
             {
                 size_t index = m_index;
-                auto& container = m_confighost.m_containers.at(index);
+                auto& container = m_confighost.container_at(index);
                 return { m_confighost, container.id_parent_inherited };
             }
             return { m_confighost, config::invalid_id };
@@ -391,7 +900,7 @@ namespace sqf::runtime
             if (!empty())
             {
                 size_t index = m_index;
-                auto& container = m_confighost.m_containers.at(index);
+                auto& container = m_confighost.container_at(index);
                 return { m_confighost, container.id_parent_logical };
             }
             return { m_confighost, config::invalid_id };
@@ -401,7 +910,7 @@ namespace sqf::runtime
             if (!empty())
             {
                 size_t index = m_index;
-                auto& container = m_confighost.m_containers.at(index);
+                auto& container = m_confighost.mutable_container(index);
                 container.value = val;
             }
         }
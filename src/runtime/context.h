@@ -45,10 +45,12 @@ namespace sqf::runtime
         void can_suspend(bool flag) { m_can_suspend = flag; }
         bool suspended() const { return m_suspended; }
         std::chrono::system_clock::time_point wakeup_timestamp() const { return m_wakeup_timestamp; }
-        template<class _Rep, class _Period>
-        void suspend(std::chrono::duration<_Rep, _Period> duration)
+        /// <summary>
+        /// Suspends this context until the provided point of the runtime clock (see runtime::now).
+        /// </summary>
+        void suspend(std::chrono::system_clock::time_point wakeup_timestamp)
         {
-            m_wakeup_timestamp = std::chrono::system_clock::now() + duration;
+            m_wakeup_timestamp = wakeup_timestamp;
             m_suspended = true;
         }
         void unsuspend() { m_suspended = false; }
@@ -143,19 +145,71 @@ namespace sqf::runtime
 
         std::optional<sqf::runtime::value> get_variable(std::string variable_name) const
         {
-            std::transform(variable_name.begin(), variable_name.end(), variable_name.begin(), [](char& c) { return (char)std::tolower((int)c); });
+            auto res = find_variable_key(value_scope::to_key(std::move(variable_name)));
+            if (res)
+            {
+                return *res;
+            }
+            return {};
+        }
+
+        /// <summary>
+        /// Same as get_variable but takes an already lowercased key (see value_scope::to_key)
+        /// and returns a pointer into the owning frame instead of a copy.
+        /// Returns nullptr if the variable could not be found.
+        /// The pointer is only valid until the frames or their variables are modified.
+        /// </summary>
+        const sqf::runtime::value* find_variable_key(const std::string& key) const
+        {
             for (auto rit = m_frames.rbegin(); rit != m_frames.rend(); rit++)
             {
-                if (rit->contains(variable_name))
+                if (auto res = rit->find_key(key))
                 {
-                    return (*rit)[variable_name];
+                    return res;
                 }
                 else if (!rit->bubble_variable())
                 {
-                    return {};
+                    return nullptr;
                 }
             }
-            return {};
+            return nullptr;
+        }
+
+        /// <summary>
+        /// Same as find_variable_key but for a local slot of the lowered program running in the current frame
+        /// (see bytecode::program::local). The variable found is cached in the current frame,
+        /// so only the first access of a slot has to look it up by name.
+        /// If ignore_bubble is set, parent frames not bubbling variables are searched too (as done by assignments).
+        /// </summary>
+        sqf::runtime::value* find_local_slot(uint32_t slot, const std::string& key, bool ignore_bubble = false)
+        {
+            auto& frame = current_frame();
+            if (auto res = frame.local_slot(slot))
+            {
+                return res;
+            }
+            bool cacheable = true;
+            for (auto rit = m_frames.rbegin(); rit != m_frames.rend(); rit++)
+            {
+                if (auto res = rit->find_key(key))
+                {
+                    // Results found past a frame not bubbling variables differ between reads and assignments
+                    if (cacheable)
+                    {
+                        frame.local_slot(slot, res, rit == m_frames.rbegin());
+                    }
+                    return res;
+                }
+                else if (!rit->bubble_variable())
+                {
+                    if (!ignore_bubble)
+                    {
+                        return nullptr;
+                    }
+                    cacheable = false;
+                }
+            }
+            return nullptr;
         }
 
         bool weak_error_handling() const { return m_weak_error_handling; }
@@ -8,6 +8,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <unordered_set>
 #include <algorithm>
 #include <sstream>
 #include <array>
@@ -26,11 +27,38 @@ namespace sqf
         public:
             using data_type = sqf::runtime::t_array;
             using iterator = std::vector<sqf::runtime::value>::iterator;
+            using const_iterator = std::vector<sqf::runtime::value>::const_iterator;
         private:
-            std::vector<sqf::runtime::value> m_value;
+            // Own storage, used unless m_shared is set.
+            mutable std::vector<sqf::runtime::value> m_own;
+            // Storage shared with other d_array instances (see copy_deep).
+            // Materialized into m_own on the first non-const access.
+            mutable std::shared_ptr<std::vector<sqf::runtime::value>> m_shared;
+
+            const std::vector<sqf::runtime::value>& values_() const { return m_shared ? *m_shared : m_own; }
+            std::vector<sqf::runtime::value>& values_mut_()
+            {
+                if (m_shared)
+                {
+                    if (m_shared.use_count() == 1) { m_own = std::move(*m_shared); }
+                    else { m_own = *m_shared; }
+                    m_shared.reset();
+                }
+                return m_own;
+            }
+            // Moves the own storage into a shared buffer (if not already) and returns it.
+            const std::shared_ptr<std::vector<sqf::runtime::value>>& share_() const
+            {
+                if (!m_shared)
+                {
+                    m_shared = std::make_shared<std::vector<sqf::runtime::value>>(std::move(m_own));
+                    m_own.clear();
+                }
+                return m_shared;
+            }
             bool recursion_test_(std::vector<std::shared_ptr<d_array>>& visited)
             {
-                for (auto& it : m_value)
+                for (auto& it : values_())
                 {
                     if (it.type() == data_type())
                     {
@@ -59,26 +87,51 @@ namespace sqf
                 }
                 return true;
             }
+            bool reaches_(const d_array* target, std::unordered_set<const d_array*>& visited) const
+            {
+                if (this == target)
+                {
+                    return true;
+                }
+                for (auto& it : values_())
+                {
+                    if (it.type() == data_type())
+                    {
+                        auto arr = it.data<sqf::types::d_array>();
+
+                        // Shared sub-arrays only need to be searched once.
+                        if (!visited.insert(arr.get()).second)
+                        {
+                            continue;
+                        }
+                        if (arr->reaches_(target, visited))
+                        {
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            }
         protected:
-            bool do_equals(std::shared_ptr<data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<data>& other, bool invariant) const override
             {
                 auto other_array = std::static_pointer_cast<d_array>(other);
-                if (other_array->size() != m_value.size()) { return false; }
-                for (size_t i = 0; i < m_value.size(); i++)
+                if (other_array->size() != values_().size()) { return false; }
+                for (size_t i = 0; i < values_().size(); i++)
                 {
                     // check if both empty
-                    if (m_value[i].empty() && other_array->m_value[i].empty())
+                    if (values_()[i].empty() && other_array->values_()[i].empty())
                     {
                         // Arma returns false on nil isEqualTo nil
                         return false;
                     }
                     // check if one is empty
-                    else if (m_value[i].empty() || other_array->m_value[i].empty())
+                    else if (values_()[i].empty() || other_array->values_()[i].empty())
                     {
                         return false;
                     }
                     // Do actual comparison
-                    else if (!m_value[i].data()->equals(other_array->m_value[i].data(), invariant))
+                    else if (!values_()[i].equals(other_array->values_()[i], invariant))
                     {
                         return false;
                     }
@@ -87,15 +140,29 @@ namespace sqf
             }
         public:
             d_array() = default;
-            d_array(size_t size) : m_value(std::vector<sqf::runtime::value>(size)) {}
-            d_array(std::vector<sqf::runtime::value> value) : m_value(std::move(value)) {}
+            d_array(size_t size) : m_own(std::vector<sqf::runtime::value>(size)) {}
+            d_array(std::vector<sqf::runtime::value> value) : m_own(std::move(value)) {}
             template<typename TIterator>
-            d_array(TIterator begin, TIterator end) : m_value(begin, end) {}
+            d_array(TIterator begin, TIterator end) : m_own(begin, end) {}
 
+            /// <summary>
+            /// Creates a deep copy of this array (nested arrays are copied too, any other value is shared).
+            /// Arrays without nested arrays share their storage with the copy until either of them is
+            /// accessed non-const (copy-on-write), making copies that are never modified cheap.
+            /// </summary>
             std::shared_ptr<d_array> copy_deep() const
             {
+                const auto& values = values_();
+                bool flat = std::none_of(values.begin(), values.end(), [](const sqf::runtime::value& val) { return val.is<sqf::runtime::t_array>(); });
+                if (flat)
+                {
+                    auto copy = std::make_shared<d_array>();
+                    copy->m_shared = share_();
+                    return copy;
+                }
                 std::vector<sqf::runtime::value> copy;
-                for (auto& val : m_value)
+                copy.reserve(values.size());
+                for (auto& val : values)
                 {
                     if (val.is<sqf::runtime::t_array>())
                     {
@@ -103,19 +170,35 @@ namespace sqf
                     }
                     else
                     {
-                        copy.emplace_back(val.data());
+                        copy.push_back(val);
+                    }
+                }
+                return std::make_shared<d_array>(std::move(copy));
+            }
+
+            /// <summary>
+            /// Moves the storage of this array and all nested arrays into shared buffers upfront.
+            /// copy_deep does that on first use otherwise, thus modifying the array.
+            /// Afterwards, the array may be copied from multiple threads as long as nobody modifies it.
+            /// </summary>
+            void share_deep() const
+            {
+                for (auto& val : *share_())
+                {
+                    if (val.is<sqf::runtime::t_array>())
+                    {
+                        val.data<d_array>()->share_deep();
                     }
                 }
-                return std::make_shared<d_array>(copy);
             }
 
             std::string to_string_sqf() const override
             {
                 std::stringstream sstream;
                 sstream << "[";
-                if (m_value.size() > 0)
+                if (values_().size() > 0)
                 {
-                    for (auto it : m_value)
+                    for (auto it : values_())
                     {
                         sstream << it.to_string_sqf() << ",";
                     }
@@ -128,9 +211,9 @@ namespace sqf
             {
                 std::stringstream sstream;
                 sstream << "[";
-                if (m_value.size() > 0)
+                if (values_().size() > 0)
                 {
-                    for (auto it : m_value)
+                    for (auto it : values_())
                     {
                         sstream << it.to_string() << ",";
                     }
@@ -144,40 +227,59 @@ namespace sqf
             // Returns false, if current array state contains a recursion.
             bool recursion_test() { std::vector<std::shared_ptr<d_array>> vec; return recursion_test_(vec); }
 
+            // Returns true, if val can be stored in this array without creating a recursion.
+            // Assumes this array is free of recursions already. Only arrays have to be searched
+            // (for this array), making the check O(1) for any other value.
+            bool can_contain(const sqf::runtime::value& val) const
+            {
+                if (!val.is<sqf::runtime::t_array>())
+                {
+                    return true;
+                }
+                std::unordered_set<const d_array*> visited;
+                return !val.data<sqf::types::d_array>()->reaches_(this, visited);
+            }
+
 
 
             sqf::runtime::value& operator[](size_t index) { return at(index); }
             sqf::runtime::value operator[](size_t index) const { return at(index); }
-            sqf::runtime::value& at(size_t index) { return m_value.at(index); }
-            sqf::runtime::value at(size_t index) const { return m_value.at(index); }
+            sqf::runtime::value& at(size_t index) { return values_mut_().at(index); }
+            sqf::runtime::value at(size_t index) const { return values_().at(index); }
             template <class T, typename TValue>
-            TValue get(size_t index) const { return m_value.at(index).data<T, TValue>(); }
+            TValue get(size_t index) const { return values_().at(index).data<T, TValue>(); }
             template <class T, typename TValue>
-            TValue get(size_t index, TValue def) const { return m_value.size() > index ? m_value.at(index).data_try<T, TValue>(def) : def; }
-            size_t size() const { return m_value.size(); }
-            bool empty() const { return m_value.empty(); }
+            TValue get(size_t index, TValue def) const { return values_().size() > index ? values_().at(index).data_try<T, TValue>(def) : def; }
+            size_t size() const { return values_().size(); }
+            bool empty() const { return values_().empty(); }
 
-            iterator begin() { return m_value.begin(); }
-            iterator end() { return m_value.end(); }
-            iterator erase(iterator it) { return m_value.erase(it); }
-            iterator erase(iterator begin, iterator end) { return m_value.erase(begin, end); }
+            // Non-const access materializes shared storage. Prefer the const overloads (or cbegin/cend) for reading.
+            iterator begin() { return values_mut_().begin(); }
+            iterator end() { return values_mut_().end(); }
+            const_iterator begin() const { return values_().begin(); }
+            const_iterator end() const { return values_().end(); }
+            const_iterator cbegin() const { return values_().begin(); }
+            const_iterator cend() const { return values_().end(); }
+            iterator erase(iterator it) { return values_mut_().erase(it); }
+            iterator erase(iterator begin, iterator end) { return values_mut_().erase(begin, end); }
             template<typename TIterator>
-            iterator insert(iterator start, TIterator begin, TIterator end) { return m_value.insert(start, begin, end); }
+            iterator insert(iterator start, TIterator begin, TIterator end) { return values_mut_().insert(start, begin, end); }
 
             //#TODO emplace back
-            bool push_back(sqf::runtime::value val) { m_value.push_back(std::move(val)); if (!recursion_test()) { m_value.pop_back(); return false; } return true; }
-            sqf::runtime::value pop_back() { auto back = m_value.back(); m_value.pop_back(); return back; }
+            bool push_back(sqf::runtime::value val) { if (!can_contain(val)) { return false; } values_mut_().push_back(std::move(val)); return true; }
+            sqf::runtime::value pop_back() { auto& values = values_mut_(); auto back = values.back(); values.pop_back(); return back; }
 
-            void reverse() { std::reverse(m_value.begin(), m_value.end()); }
+            void reverse() { auto& values = values_mut_(); std::reverse(values.begin(), values.end()); }
             void resize(size_t newsize)
             {
-                auto cursize = m_value.size();
-                m_value.resize(newsize);
+                auto& values = values_mut_();
+                auto cursize = values.size();
+                values.resize(newsize);
                 if (newsize > cursize)
                 {
                     for (; cursize < newsize; cursize++)
                     {
-                        m_value[cursize] = sqf::runtime::value();
+                        values[cursize] = sqf::runtime::value();
                     }
                 }
             }
@@ -185,27 +287,30 @@ namespace sqf
             virtual std::size_t hash() const override
             {
                 size_t hash = 0x9e3779b9;
-                for (auto& it : m_value)
+                for (auto& it : values_())
                 {
                     hash ^= std::hash<sqf::runtime::value>()(it) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
                 }
                 return hash;
             }
 
-            std::vector<sqf::runtime::value> value() const { return m_value; }
-            std::vector<sqf::runtime::value>& value() { return m_value; }
+            std::vector<sqf::runtime::value> value() const { return values_(); }
+            // Read-only access to the elements without copying them.
+            const std::vector<sqf::runtime::value>& view() const { return values_(); }
+            std::vector<sqf::runtime::value>& value() { return values_mut_(); }
 
             operator std::vector<sqf::runtime::value>()
             {
-                std::vector<sqf::runtime::value> vec = m_value;
+                std::vector<sqf::runtime::value> vec = values_();
                 return vec;
             }
-            operator sqf::runtime::vec3()
+            operator sqf::runtime::vec3() const
             {
                 sqf::runtime::vec3 v;
-                if (size() > 0) { v.x = at(0).data_try<d_scalar, float>(0); }
-                if (size() > 1) { v.y = at(1).data_try<d_scalar, float>(0); }
-                if (size() > 2) { v.z = at(2).data_try<d_scalar, float>(0); }
+                const auto& values = values_();
+                if (values.size() > 0) { v.x = values[0].data_try<d_scalar, float>(0); }
+                if (values.size() > 1) { v.y = values[1].data_try<d_scalar, float>(0); }
+                if (values.size() > 2) { v.z = values[2].data_try<d_scalar, float>(0); }
                 return v;
             }
 
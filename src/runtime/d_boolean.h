@@ -9,10 +9,6 @@
 
 namespace sqf
 {
-    namespace runtime
-    {
-        struct t_boolean : public type::extend<t_boolean> { t_boolean() : extend() {} static const std::string name() { return "BOOL"; } };
-    }
     namespace types
     {
         class d_boolean : public sqf::runtime::data
@@ -22,7 +18,7 @@ namespace sqf
         private:
             bool m_value;
         protected:
-            bool do_equals(std::shared_ptr<sqf::runtime::data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<sqf::runtime::data>& other, bool invariant) const override
             {
                 return m_value == std::static_pointer_cast<d_boolean>(other)->m_value;
             }
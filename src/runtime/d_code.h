@@ -26,7 +26,7 @@ namespace sqf
             sqf::runtime::instruction_set m_value;
 
         protected:
-            bool do_equals(std::shared_ptr<data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<data>& other, bool invariant) const override
             {
                 auto casted = std::static_pointer_cast<d_code>(other);
                 return std::equal(m_value.begin(), m_value.end(), casted->m_value.begin(), casted->m_value.end(),
@@ -9,10 +9,6 @@
 
 namespace sqf
 {
-    namespace runtime
-    {
-        struct t_scalar : public type::extend<t_scalar> { t_scalar() : extend() {} static const std::string name() { return "SCALAR"; } };
-    }
     namespace types
     {
         class d_scalar : public sqf::runtime::data
@@ -23,7 +19,7 @@ namespace sqf
             float m_value;
             inline static int s_decimals = -1;
         protected:
-            bool do_equals(std::shared_ptr<data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<data>& other, bool invariant) const override
             {
                 return m_value == std::static_pointer_cast<d_scalar>(other)->m_value;
             }
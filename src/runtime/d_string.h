@@ -24,9 +24,9 @@ namespace sqf
         private:
             std::string m_value;
         protected:
-            bool do_equals(std::shared_ptr<data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<data>& other, bool invariant) const override
             {
-                auto otherstr = std::static_pointer_cast<d_string>(other)->m_value;
+                const auto& otherstr = static_cast<const d_string&>(*other).m_value;
                 if (invariant)
                 {
                     if (m_value.length() != otherstr.length()) { return false; }
@@ -93,6 +93,8 @@ namespace sqf
             sqf::runtime::type type() const override { return data_type(); }
             virtual std::size_t hash() const override { return std::hash<std::string>()(m_value); }
             std::string value() const { return m_value; }
+            // View into the string, valid as long as this d_string is neither modified nor destroyed.
+            std::string_view view() const { return m_value; }
             void value(std::string string) { m_value = string; }
 
             operator std::string() { return m_value; }
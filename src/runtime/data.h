@@ -39,7 +39,7 @@ namespace sqf::runtime
         /// <param name="other">The other value</param>
         /// <param name="invariant">Wether operation should be case sensitive (false) or not (true)</param>
         /// <returns>The result of the comparison</returns>
-        virtual bool do_equals(std::shared_ptr<data> other, bool invariant) const = 0;
+        virtual bool do_equals(const std::shared_ptr<data>& other, bool invariant) const = 0;
 
     public:
 
@@ -69,7 +69,7 @@ namespace sqf::runtime
         /// <param name="other">The other value</param>
         /// <param name="invariant">Wether operation should be case sensitive (false) or not (true)</param>
         /// <returns>The result of the comparison</returns>
-        bool equals(std::shared_ptr<data> other, bool invariant = false) const
+        bool equals(const std::shared_ptr<data>& other, bool invariant = false) const
         {
             if (other->type() != type()) { return false; }
             if (other.get() == this) { return true; }
@@ -22,7 +22,7 @@ namespace sqf
         private:
             sqf::runtime::diagnostics::stacktrace m_value;
         protected:
-            bool do_equals(std::shared_ptr<sqf::runtime::data> other, bool invariant) const override
+            bool do_equals(const std::shared_ptr<sqf::runtime::data>& other, bool invariant) const override
             {
                 // A stacktrace is never equal to another stacktrace
                 return false;
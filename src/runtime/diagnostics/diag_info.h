@@ -3,6 +3,7 @@
 
 #include <string>
 #include <string_view>
+#include <algorithm>
 
 
 namespace sqf::runtime::diagnostics
@@ -62,5 +63,47 @@ namespace sqf::runtime::diagnostics
         }
 
         operator sqf::runtime::fileio::pathinfo() const { return path; }
+
+        /// <summary>
+        /// Creates a human readable excerpt of the provided source, pointing at off with length '^' characters.
+        /// </summary>
+        static std::string create_code_segment(std::string_view view, size_t off, size_t length)
+        {
+            size_t i = off < 15 ? 0 : off - 15;
+            size_t len = 30 + length;
+            if (i < 0)
+            {
+                len += i;
+                i = 0;
+            }
+            for (size_t j = i; j < i + len && j < view.length(); j++)
+            {
+                char wc = view[j];
+                if (wc == '\n')
+                {
+                    if (j < off)
+                    {
+                        i = j + 1;
+                    }
+                    else
+                    {
+                        len = j - i;
+                        break;
+                    }
+                }
+            }
+
+            std::string spacing(off - i, ' ');
+            std::string postfix(std::max<size_t>(1, length), '^');
+
+            std::string txt;
+            txt.reserve(len + 1 + spacing.length() + postfix.length() + 1);
+            txt.append(view.substr(i, len));
+            txt.append("\n");
+            txt.append(spacing);
+            txt.append(postfix);
+            txt.append("\n");
+            return txt;
+        }
     };
 }
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+#include "diag_info.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace sqf::runtime::diagnostics
+{
+    /// <summary>
+    /// A (preprocessed) source buffer shared by every instruction parsed from it.
+    /// Owns the physical paths referenced by the source_location records
+    /// pointing into it (a single buffer may contain multiple paths due to #line).
+    /// </summary>
+    class source_file
+    {
+    private:
+        std::string m_contents;
+        std::vector<std::string> m_paths;
+        uint32_t m_last_path;
+
+    public:
+        source_file(std::string contents) : m_contents(std::move(contents)), m_paths(), m_last_path(0) {}
+
+        std::string_view contents() const { return m_contents; }
+        // Mutable access to the buffer for tokenizers working on std::string::iterator. Only to be used while parsing.
+        std::string& buffer() { return m_contents; }
+        std::string_view path(uint32_t id) const { return id < m_paths.size() ? std::string_view(m_paths[id]) : std::string_view{}; }
+
+        /// <summary>
+        /// Returns the id of the provided physical path, adding it if not yet known.
+        /// Consecutive tokens almost always share their path, hence the last hit is checked first.
+        /// </summary>
+        uint32_t path_id(std::string_view physical)
+        {
+            if (m_last_path < m_paths.size() && m_paths[m_last_path] == physical)
+            {
+                return m_last_path;
+            }
+            for (uint32_t i = 0; i < m_paths.size(); i++)
+            {
+                if (m_paths[i] == physical)
+                {
+                    return m_last_path = i;
+                }
+            }
+            m_paths.emplace_back(physical);
+            return m_last_path = (uint32_t)(m_paths.size() - 1);
+        }
+    };
+
+    /// <summary>
+    /// Compact location record of an instruction.
+    /// The full diag_info (including the code segment) is only materialized on demand.
+    /// </summary>
+    struct source_location
+    {
+        std::shared_ptr<const source_file> file;
+        uint32_t path;
+        uint32_t line;
+        uint32_t column;
+        uint32_t offset;
+        uint32_t length;
+
+        source_location() : file(), path(0), line(0), column(0), offset(0), length(0) {}
+        source_location(std::shared_ptr<const source_file> file, uint32_t path, size_t line, size_t column, size_t offset, size_t length) :
+            file(std::move(file)),
+            path(path),
+            line((uint32_t)line),
+            column((uint32_t)column),
+            offset((uint32_t)offset),
+            length((uint32_t)length)
+        {
+        }
+
+        bool empty() const { return !file; }
+        std::string_view physical() const { return file ? file->path(path) : std::string_view{}; }
+
+        sqf::runtime::diagnostics::diag_info to_diag_info() const
+        {
+            if (!file)
+            {
+                return {};
+            }
+            sqf::runtime::diagnostics::diag_info dinf(
+                line,
+                column,
+                offset,
+                { std::string(physical()), {} },
+                sqf::runtime::diagnostics::diag_info::create_code_segment(file->contents(), offset, length));
+            dinf.length = length;
+            return dinf;
+        }
+    };
+}
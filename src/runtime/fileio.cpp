@@ -4,6 +4,18 @@
 #include <vector>
 #include <filesystem>
 
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #ifdef DF__SQF_FILEIO__TRACE_REESOLVE
 #include <iostream>
 #endif // DF__SQF_FILEIO__TRACE_REESOLVE
@@ -109,6 +121,74 @@ std::optional<std::string> sqf::runtime::fileio::read_file_from_disk(std::string
     return std::string(buffer.begin() + get_bom_skip(buffer), buffer.end());
 }
 
+sqf::runtime::fileio::mapped_file::~mapped_file()
+{
+#if defined(_WIN32)
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mapping);
+    CloseHandle(m_file);
+#else
+    munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
+std::shared_ptr<const sqf::runtime::fileio::mapped_file> sqf::runtime::fileio::map_file_from_disk(std::string_view physical_path)
+{
+    std::string path(physical_path);
+#if defined(_WIN32)
+    auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return {};
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return {};
+    }
+    auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        CloseHandle(file);
+        return {};
+    }
+    auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return {};
+    }
+    std::shared_ptr<mapped_file> mapped(new mapped_file());
+    mapped->m_data = static_cast<const char*>(data);
+    mapped->m_size = static_cast<size_t>(size.QuadPart);
+    mapped->m_file = file;
+    mapped->m_mapping = mapping;
+#else
+    auto fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        return {};
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0)
+    {
+        close(fd);
+        return {};
+    }
+    auto data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping stays valid after closing the descriptor
+    if (data == MAP_FAILED)
+    {
+        return {};
+    }
+    std::shared_ptr<mapped_file> mapped(new mapped_file());
+    mapped->m_data = static_cast<const char*>(data);
+    mapped->m_size = static_cast<size_t>(info.st_size);
+#endif
+    return mapped;
+}
+
 void sqf::runtime::fileio::add_mapping_auto(std::string_view phys)
 {
     const std::filesystem::path ignoreGit(".git");
@@ -4,6 +4,7 @@
 #include <optional>
 #include <filesystem>
 #include <vector>
+#include <memory>
 
 namespace sqf
 {
@@ -41,6 +42,27 @@ namespace sqf
                 bool operator==(const pathinfo& b) const { return physical == physical; }
                 bool operator!=(const pathinfo& b) const { return physical != physical; }
             };
+
+            /// <summary>
+            /// A file mapped read-only into memory. The mapping is released on destruction.
+            /// </summary>
+            class mapped_file
+            {
+            private:
+                const char* m_data;
+                size_t m_size;
+#if defined(_WIN32)
+                void* m_file;
+                void* m_mapping;
+#endif
+                mapped_file() = default;
+                friend class fileio;
+            public:
+                mapped_file(const mapped_file&) = delete;
+                mapped_file& operator=(const mapped_file&) = delete;
+                ~mapped_file();
+                std::string_view contents() const { return { m_data, m_size }; }
+            };
         public:
             virtual ~fileio() {}
             /// <summary>
@@ -59,6 +81,14 @@ namespace sqf
             /// <param name="physical_path">The physical path of the file</param>
             /// <returns>The contents of the file. Optional will be empty if file does not exist or could not be opened for any other reason.</returns>
             static std::optional<std::string> read_file_from_disk(std::string physical_path) { return read_file_from_disk(std::string_view(physical_path)); }
+            /// <summary>
+            /// Convenience method to map a file from disk into memory, avoiding to copy its contents.
+            /// Will not use the filesystem to resolve the path.
+            /// Unlike read_file_from_disk, no byte order mark is skipped.
+            /// </summary>
+            /// <param name="physical_path">The physical path of the file</param>
+            /// <returns>The mapped file. Empty if the file does not exist, is empty or could not be mapped for any other reason.</returns>
+            static std::shared_ptr<const mapped_file> map_file_from_disk(std::string_view physical_path);
 
             /// <summary>
             /// Method to receive path informations of a new path.
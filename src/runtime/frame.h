@@ -3,6 +3,9 @@
 #include "instruction_set.h"
 #include "value_scope.h"
 
+#include <vector>
+#include <cstdint>
+
 #ifdef DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
 #include <iostream>
 #endif // DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
@@ -81,7 +84,44 @@ namespace sqf::runtime
         };
         friend class behavior;
     private:
+        /// <summary>
+        /// Variables resolved for the local slots of the running program (see bytecode::program::local).
+        /// Copies start out empty, as the cached pointers refer to the variables of the frames copied from.
+        /// </summary>
+        class local_slots
+        {
+        public:
+            struct entry
+            {
+                sqf::runtime::value* variable;
+                // variable_count() of the owning frame at the time the variable got resolved in a parent frame,
+                // as adding a variable to the owning frame may shadow it. own_variable if it lives in the owning frame.
+                size_t guard;
+            };
+            static const size_t own_variable = ~(size_t)0;
+        private:
+            std::vector<entry> m_entries;
+        public:
+            local_slots() = default;
+            local_slots(const local_slots&) {}
+            local_slots(local_slots&&) noexcept = default;
+            local_slots& operator=(const local_slots&) { m_entries.clear(); return *this; }
+            local_slots& operator=(local_slots&&) noexcept = default;
+
+            const entry* get(uint32_t slot) const { return slot < m_entries.size() ? &m_entries[slot] : nullptr; }
+            void set(uint32_t slot, entry value)
+            {
+                if (slot >= m_entries.size())
+                {
+                    m_entries.resize(slot + 1, { nullptr, 0 });
+                }
+                m_entries[slot] = value;
+            }
+            void clear() { m_entries.clear(); }
+        };
+
         sqf::runtime::instruction_set m_instruction_set;
+        local_slots m_local_slots;
         // Use index over iterator due to iterator invalidation problems
         size_t m_position;
         std::shared_ptr<behavior> m_exit_behavior;
@@ -158,6 +198,7 @@ namespace sqf::runtime
                 return result::ok;
             case behavior::result::exchange:
                 m_instruction_set = m_error_behavior->get_instruction_set(*this);
+                m_local_slots.clear();
                 seek(0, ::sqf::runtime::frame::seekpos::start);
 #ifdef DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
 
@@ -236,10 +277,35 @@ namespace sqf::runtime
             return it;
         }
 
+        /// <summary>
+        /// Returns the variable cached for the provided local slot of the running program
+        /// or nullptr if it has not been resolved yet or may have been shadowed since.
+        /// </summary>
+        sqf::runtime::value* local_slot(uint32_t slot) const
+        {
+            auto entry = m_local_slots.get(slot);
+            return entry && (entry->guard == local_slots::own_variable || entry->guard == variable_count()) ? entry->variable : nullptr;
+        }
+        /// <summary>
+        /// Caches the variable a local slot of the running program resolved to.
+        /// own tells whether the variable lives in this frame, rather than in one of its parents.
+        /// </summary>
+        void local_slot(uint32_t slot, sqf::runtime::value* variable, bool own)
+        {
+            m_local_slots.set(slot, { variable, own ? local_slots::own_variable : variable_count() });
+        }
+        void clear_value_scope()
+        {
+            sqf::runtime::value_scope::clear_value_scope();
+            m_local_slots.clear();
+        }
+
         bool bubble_variable() const { return m_bubble_variable; }
         void bubble_variable(bool flag) { m_bubble_variable = flag; }
 
         sqf::runtime::instruction_set::iterator current() const { return m_instruction_set.begin() + m_position; }
+        const sqf::runtime::bytecode::op& current_op() const { return m_instruction_set.program()[m_position]; }
+        const sqf::runtime::bytecode::program& program() const { return m_instruction_set.program(); }
         std::shared_ptr<sqf::runtime::value_scope> globals_value_scope() const { return m_globals_value_scope; }
         void globals_value_scope(std::shared_ptr<sqf::runtime::value_scope> scope) { m_globals_value_scope = scope; }
 
@@ -288,6 +354,7 @@ namespace sqf::runtime
                     goto start; // do not call here, reuse current stack
                 case behavior::result::exchange:
                     m_instruction_set = m_exit_behavior->get_instruction_set(*this);
+                    m_local_slots.clear();
                     seek(0, ::sqf::runtime::frame::seekpos::start);
 #ifdef DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
 
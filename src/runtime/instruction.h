@@ -1,5 +1,7 @@
 #pragma once
 #include "diagnostics/diag_info.h"
+#include "diagnostics/source_location.h"
+#include "bytecode.h"
 
 #include <string>
 #include <memory>
@@ -14,7 +16,10 @@ namespace sqf::runtime
     public:
         using sptr = std::shared_ptr<sqf::runtime::instruction>;
     private:
-        sqf::runtime::diagnostics::diag_info m_diag_info;
+        // Compact location record, resolved into a full diag_info only when requested.
+        sqf::runtime::diagnostics::source_location m_location;
+        // Explicitly set diag_info, taking precedence over m_location. Empty for parsed instructions.
+        std::shared_ptr<const sqf::runtime::diagnostics::diag_info> m_diag_info;
     public:
         virtual ~instruction() {};
         virtual void execute(runtime& runtime) const = 0;
@@ -25,7 +30,29 @@ namespace sqf::runtime
             short parent_precedence, bool left_from_binary) const = 0;
         virtual bool equals(const instruction* p_other) const = 0;
 
-        sqf::runtime::diagnostics::diag_info diag_info() const { return m_diag_info; }
-        void diag_info(sqf::runtime::diagnostics::diag_info dinf) { m_diag_info = dinf; }
+        /// <summary>
+        /// Appends the flat representation of this instruction to the provided program.
+        /// Instructions unknown to the dispatch loop are executed via execute.
+        /// </summary>
+        virtual void lower(sqf::runtime::bytecode::program& program) const { program.emit(sqf::runtime::bytecode::opkind::generic, this); }
+
+        /// <summary>
+        /// Materializes the diagnostic information of this instruction.
+        /// Creates the code segment on every call, hence should be kept off hot paths.
+        /// </summary>
+        sqf::runtime::diagnostics::diag_info diag_info() const { return m_diag_info ? *m_diag_info : m_location.to_diag_info(); }
+        void diag_info(sqf::runtime::diagnostics::diag_info dinf) { m_diag_info = std::make_shared<const sqf::runtime::diagnostics::diag_info>(std::move(dinf)); }
+
+        const sqf::runtime::diagnostics::source_location& location() const { return m_location; }
+        void location(sqf::runtime::diagnostics::source_location location) { m_location = std::move(location); m_diag_info.reset(); }
+
+        /// <summary>
+        /// Line of this instruction. Does not materialize the diag_info.
+        /// </summary>
+        size_t line() const { return m_diag_info ? m_diag_info->line : m_location.line; }
+        /// <summary>
+        /// Physical path of this instruction. Does not materialize the diag_info.
+        /// </summary>
+        std::string_view physical_path() const { return m_diag_info ? std::string_view(m_diag_info->path.physical) : m_location.physical(); }
     };
 }
\ No newline at end of file
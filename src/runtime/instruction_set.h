@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <initializer_list>
+#include <memory>
 
 namespace sqf::runtime
 {
@@ -16,10 +17,22 @@ namespace sqf::runtime
         using reverse_iterator = std::vector<sqf::runtime::instruction::sptr>::const_reverse_iterator;
     private:
         std::vector<sqf::runtime::instruction::sptr> m_instructions;
+        // Lowered form of m_instructions, shared between all copies of this set.
+        std::shared_ptr<const sqf::runtime::bytecode::program> m_program;
+
+        void lower()
+        {
+            auto program = std::make_shared<sqf::runtime::bytecode::program>();
+            for (auto& it : m_instructions)
+            {
+                it->lower(*program);
+            }
+            m_program = program;
+        }
     public:
-        instruction_set() {}
-        instruction_set(std::initializer_list<sqf::runtime::instruction::sptr> initializer) : m_instructions(initializer.begin(), initializer.end()) {}
-        instruction_set(std::vector<sqf::runtime::instruction::sptr> instructions) : m_instructions(std::move(instructions)) {}
+        instruction_set() : m_program(std::make_shared<sqf::runtime::bytecode::program>()) {}
+        instruction_set(std::initializer_list<sqf::runtime::instruction::sptr> initializer) : m_instructions(initializer.begin(), initializer.end()) { lower(); }
+        instruction_set(std::vector<sqf::runtime::instruction::sptr> instructions) : m_instructions(std::move(instructions)) { lower(); }
 
         iterator begin() const { return m_instructions.begin(); }
         iterator end() const { return m_instructions.end(); }
@@ -27,5 +40,6 @@ namespace sqf::runtime
         reverse_iterator rend() const { return m_instructions.rend(); }
         bool empty() const { return m_instructions.empty(); }
         size_t size() const { return m_instructions.size(); }
+        const sqf::runtime::bytecode::program& program() const { return *m_program; }
     };
 }
\ No newline at end of file
@@ -11,6 +11,33 @@ void StdOutLogger::log(const LogMessageBase& message) {
 }
 #pragma endregion StdOutLogger
 
+#pragma region BufferedLogger
+namespace {
+    class BufferedLogMessage : public LogMessageBase {
+        std::string_view m_message;
+    public:
+        BufferedLogMessage(loglevel level, size_t code, std::string_view message) : LogMessageBase(level, code), m_message(message) {}
+        [[nodiscard]] std::string formatMessage() const override { return std::string(m_message); }
+    };
+}
+BufferedLogger::BufferedLogger(const Logger& target) : Logger() {
+    for (size_t i = 0; i < enabledWarningLevels.size(); i++) {
+        enabledWarningLevels[i] = target.isEnabled(static_cast<loglevel>(i));
+    }
+}
+void BufferedLogger::log(const LogMessageBase& message) {
+    m_entries.push_back({ message.getLevel(), message.getErrorCode(), message.formatMessage() });
+}
+void BufferedLogger::flush(Logger& target) {
+    for (auto& it : m_entries) {
+        if (target.isEnabled(it.level)) {
+            target.log(BufferedLogMessage(it.level, it.errorCode, it.message));
+        }
+    }
+    m_entries.clear();
+}
+#pragma endregion BufferedLogger
+
 #pragma region LogLocationInfo
 LogLocationInfo::LogLocationInfo(const sqf::runtime::diagnostics::diag_info& info)
 {
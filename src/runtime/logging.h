@@ -3,6 +3,7 @@
 #include <mutex>
 #include <utility>
 #include <vector>
+#include <string>
 #include <string_view>
 #include <memory>
 #include <array>
@@ -88,6 +89,23 @@ public:
 
     virtual void log(const LogMessageBase& message) override;
 };
+// Keeps messages in memory until they get flushed into another logger.
+// Allows eg. work done on other threads to log in a deterministic order.
+class BufferedLogger : public Logger {
+    struct entry {
+        loglevel level;
+        size_t errorCode;
+        std::string message;
+    };
+    std::vector<entry> m_entries;
+public:
+    // Enables the same warning levels as the logger the messages will be flushed into.
+    BufferedLogger(const Logger& target);
+
+    virtual void log(const LogMessageBase& message) override;
+    void flush(Logger& target);
+    void clear() { m_entries.clear(); }
+};
 
 //Classes that can log, inherit from this
 class CanLog {
@@ -23,7 +23,7 @@ namespace sqf
                 /// @param  target      The targeted confighost, the config should be parsed into.
                 /// @param  contents    The actual file contents.
                 /// @param  pathinfo    The path to the file.
-                /// @returns            True on success. False on Failure.
+                /// @returns            True on success. False on Failure, the confighost is left unchanged in that case.
                 virtual bool parse(::sqf::runtime::confighost& target, std::string contents, ::sqf::runtime::fileio::pathinfo pathinfo) = 0;
             };
         }
@@ -3,18 +3,97 @@
 #include "d_array.h"
 #include "d_string.h"
 #include "diagnostics/d_stacktrace.h"
+#include "../opcodes/common.h"
 
 #include <optional>
+#include <thread>
+#include <algorithm>
 
 #ifdef DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
 #include <iostream>
 #include <iomanip>
 #endif // DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
 
+#if !defined(DF__SQF_RUNTIME__DISABLE_BYTECODE)
+// Executes a single operation of a lowered instruction set.
+// Known opcodes run from the operands decoded into the program, the source instruction is only consulted for diagnostics.
+static inline void execute_op(sqf::runtime::runtime& runtime, const sqf::runtime::bytecode::program& program, const sqf::runtime::bytecode::op& op)
+{
+    using opkind = sqf::runtime::bytecode::opkind;
+    switch (op.kind)
+    {
+    case opkind::push:
+        runtime.context_active().push_value(program.constant_at(op.operand));
+        break;
+    case opkind::end_statement:
+        runtime.context_active().clear_values();
+        break;
+    case opkind::make_array:
+        sqf::opcodes::make_array::execute(runtime, *op.source, op.operand);
+        break;
+    case opkind::get_variable:
+    {
+        auto& variable = program.variable_at(op.operand);
+        sqf::opcodes::get_variable::execute(runtime, *op.source, variable.name, variable.key);
+        break;
+    }
+    case opkind::get_local:
+    {
+        auto& variable = program.local_at(op.operand);
+        sqf::opcodes::get_variable::execute_local(runtime, *op.source, op.operand, variable.name, variable.key);
+        break;
+    }
+    case opkind::assign_to:
+    {
+        auto& variable = program.variable_at(op.operand);
+        sqf::opcodes::assign_to::execute(runtime, *op.source, variable.name, variable.key);
+        break;
+    }
+    case opkind::assign_to_existing_local:
+    {
+        auto& variable = program.local_at(op.operand);
+        sqf::opcodes::assign_to::execute_local(runtime, *op.source, op.operand, variable.name, variable.key);
+        break;
+    }
+    case opkind::assign_to_local:
+    {
+        auto& variable = program.local_at(op.operand);
+        sqf::opcodes::assign_to_local::execute_local(runtime, *op.source, op.operand, variable.name, variable.key);
+        break;
+    }
+    case opkind::call_nular:
+    {
+        auto& call = program.nular_at(op.operand);
+        sqf::opcodes::call_nular::execute(runtime, *op.source, call.id, call.name, call.cache);
+        break;
+    }
+    case opkind::call_unary:
+    {
+        auto& call = program.unary_at(op.operand);
+        sqf::opcodes::call_unary::execute(runtime, *op.source, call.id, call.name, call.cache);
+        break;
+    }
+    case opkind::call_binary:
+    {
+        auto& call = program.binary_at(op.operand);
+        sqf::opcodes::call_binary::execute(runtime, *op.source, call.id, call.name, call.cache);
+        break;
+    }
+    case opkind::generic:
+    default:
+        op.source->execute(runtime);
+        break;
+    }
+}
+#endif // !DF__SQF_RUNTIME__DISABLE_BYTECODE
+
 static sqf::runtime::runtime::result execute_do(sqf::runtime::runtime& runtime, size_t exit_after)
 {
     auto& context_active = runtime.context_active();
     auto& runtime_error = runtime.__runtime_error();
+#if !defined(DF__SQF_RUNTIME__DISABLE_BYTECODE)
+    const bool use_bytecode = !runtime.configuration().disable_bytecode;
+#endif // !DF__SQF_RUNTIME__DISABLE_BYTECODE
     while (true)
     {
         if (runtime.is_exit_requested())
@@ -95,8 +174,7 @@ static sqf::runtime::runtime::result execute_do(sqf::runtime::runtime& runtime,
         }
 
         auto instruction = frame.current();
-        if (runtime.configuration().max_runtime != std::chrono::milliseconds::zero() &&
-            runtime.configuration().max_runtime + runtime.runtime_timestamp() < std::chrono::system_clock::now())
+        if (runtime.max_runtime_exceeded())
         {
 #ifdef DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
             std::cout << "\x1B[33m[ASSEMBLY ASSERT]\033[0m" <<
@@ -110,16 +188,14 @@ static sqf::runtime::runtime::result execute_do(sqf::runtime::runtime& runtime,
         }
 
         // Check if breakpoint was hit
+        if (runtime.breakpoints_armed())
         {
-            auto dinf = (*instruction)->diag_info();
-            for (const auto& breakpoint : runtime.breakpoints())
+            auto breakpoint = runtime.breakpoint_at((*instruction)->line(), (*instruction)->physical_path());
+            if (breakpoint)
             {
-                if (breakpoint.is_enabled() && breakpoint.line() == dinf.line && breakpoint.file() == dinf.path.physical)
-                {
-                    runtime.breakpoint_hit(breakpoint);
-                    context_active.current_frame().previous(); // Unput instruction
-                    return sqf::runtime::runtime::result::ok;
-                }
+                runtime.breakpoint_hit(*breakpoint);
+                context_active.current_frame().previous(); // Unput instruction
+                return sqf::runtime::runtime::result::ok;
             }
         }
 
@@ -203,7 +279,16 @@ static sqf::runtime::runtime::result execute_do(sqf::runtime::runtime& runtime,
 #endif // DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
 
 
-        (*instruction)->execute(runtime);
+#if !defined(DF__SQF_RUNTIME__DISABLE_BYTECODE)
+        if (use_bytecode)
+        {
+            execute_op(runtime, frame.program(), frame.current_op());
+        }
+        else
+#endif // !DF__SQF_RUNTIME__DISABLE_BYTECODE
+        {
+            (*instruction)->execute(runtime);
+        }
 
 
         if (!runtime_error)
@@ -255,6 +340,74 @@ static sqf::runtime::runtime::result execute_do(sqf::runtime::runtime& runtime,
     }
 }
 
+void sqf::runtime::runtime::sqfop_dispatch_build(sqf::runtime::sqfop_id id, sqfop_dispatch_table<sqf::runtime::sqfop_binary>& table)
+{
+    size_t any = sqf::types::t_any();
+    table.types = (size_t)sqf::runtime::type::max_value() + 1;
+    table.operators.assign(table.types * table.types, nullptr);
+    if (id >= m_operators_by_id_binary.size())
+    {
+        return;
+    }
+    const auto& overloads = m_operators_by_id_binary[id];
+    for (size_t l = 0; l < table.types; l++)
+    {
+        for (size_t r = 0; r < table.types; r++)
+        {
+            // Lookup order: exact, ANY left, ANY right, ANY both
+            const sqf::runtime::sqfop_binary* best = nullptr;
+            int best_rank = 4;
+            for (auto op : overloads)
+            {
+                size_t op_l = op->left_type();
+                size_t op_r = op->right_type();
+                int rank;
+                if (op_l == l && op_r == r) { rank = 0; }
+                else if (op_l == any && op_r == r) { rank = 1; }
+                else if (op_l == l && op_r == any) { rank = 2; }
+                else if (op_l == any && op_r == any) { rank = 3; }
+                else { continue; }
+                if (rank < best_rank)
+                {
+                    best = op;
+                    best_rank = rank;
+                }
+            }
+            table.operators[l * table.types + r] = best;
+        }
+    }
+}
+void sqf::runtime::runtime::sqfop_dispatch_build(sqf::runtime::sqfop_id id, sqfop_dispatch_table<sqf::runtime::sqfop_unary>& table)
+{
+    size_t any = sqf::types::t_any();
+    table.types = (size_t)sqf::runtime::type::max_value() + 1;
+    table.operators.assign(table.types, nullptr);
+    if (id >= m_operators_by_id_unary.size())
+    {
+        return;
+    }
+    const auto& overloads = m_operators_by_id_unary[id];
+    for (size_t r = 0; r < table.types; r++)
+    {
+        // Lookup order: exact, ANY
+        const sqf::runtime::sqfop_unary* best = nullptr;
+        for (auto op : overloads)
+        {
+            size_t op_r = op->right_type();
+            if (op_r == r)
+            {
+                best = op;
+                break;
+            }
+            else if (op_r == any)
+            {
+                best = op;
+            }
+        }
+        table.operators[r] = best;
+    }
+}
+
 sqf::runtime::runtime::result sqf::runtime::runtime::execute(sqf::runtime::runtime::action action)
 {
     sqf::runtime::runtime::result res = result::invalid;
@@ -299,7 +452,7 @@ sqf::runtime::runtime::result sqf::runtime::runtime::execute(sqf::runtime::runti
             }
             if (m_is_exit_requested)
             {
-                m_contexts.clear();
+                contexts_clear();
                 m_state = state::empty;
             }
             m_run_atomic = false;
@@ -321,63 +474,80 @@ sqf::runtime::runtime::result sqf::runtime::runtime::execute(sqf::runtime::runti
             m_is_exit_requested = false;
             m_is_halt_requested = false;
             m_state = state::running;
+            scheduler_reset();
             while (!m_contexts.empty())
             {
-                for (size_t i = 0; i < m_contexts.size(); i++)
+                if (!m_contexts_sleeping.empty())
                 {
-                    m_context_active = m_contexts[i];
-                    if (m_context_active->suspended())
-                    {
-                        if (m_context_active->wakeup_timestamp() <= std::chrono::system_clock::now())
-                        {
-                            m_context_active->unsuspend();
-                            res = execute_do(*this, 150);
-                        }
-                        else
+                    auto now = this->now();
+                    scheduler_wakeup(now);
+                    if (m_contexts_ready.empty() && configuration().virtual_time)
+                    { // Nothing runnable, fast-forward the clock to the next context that is due.
+                        m_virtual_time_offset += m_contexts_sleeping.top().timestamp - now;
+                        scheduler_wakeup(m_contexts_sleeping.top().timestamp);
+                    }
+                    else if (m_contexts_ready.empty())
+                    { // Nothing runnable, block until the next context is due.
+                        auto wakeup = std::min(m_contexts_sleeping.top().timestamp, now + scheduler_idle_slice);
+                        std::this_thread::sleep_until(wakeup - m_virtual_time_offset);
+                        if (m_is_exit_requested)
                         {
-                            res = result::ok;
+                            contexts_clear();
+                            m_state = state::empty;
+                            goto start_loop_exit;
                         }
+                        continue;
                     }
-                    else
+                }
+                else if (m_contexts_ready.empty())
+                { // Contexts got added without passing context_create.
+                    scheduler_reset();
+                }
+                m_context_active = m_contexts_ready.front();
+                m_contexts_ready.pop_front();
+                res = execute_do(*this, 150);
+                if (m_is_exit_requested)
+                {
+                    contexts_clear();
+                    m_state = state::empty;
+                    goto start_loop_exit;
+                }
+                perform_evaluate();
+                switch (res)
+                {
+                case sqf::runtime::runtime::result::empty:
+                {
+#ifdef DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
+                    std::cout << "\x1B[33m[ASSEMBLY ASSERT]\033[0m" <<
+                        "        " <<
+                        "        " <<
+                        "    " << "\x1B[36mERASE CONTEXT\033[0m \x1B[90" << (m_context_active->name().empty() ? "<unnamed>" : m_context_active->name()) << "\033[0m" << std::endl;
+#endif // DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
+                    auto opt_val = m_context_active->pop_value(true);
+                    if (opt_val.has_value() && configuration().print_context_work_to_log_on_exit)
                     {
-                        res = execute_do(*this, 150);
+                        __logmsg(logmessage::runtime::ContextValuePrint(opt_val.value()));
                     }
-                    if (m_is_exit_requested)
+                    auto it = std::find(m_contexts.begin(), m_contexts.end(), m_context_active);
+                    if (it != m_contexts.end())
                     {
-                        m_contexts.clear();
-                        m_state = state::empty;
-                        goto start_loop_exit;
+                        m_contexts.erase(it);
                     }
-                    perform_evaluate();
-                    switch (res)
-                    {
-                    case sqf::runtime::runtime::result::empty:
+                    if (m_contexts.empty())
                     {
-#ifdef DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
-                        std::cout << "\x1B[33m[ASSEMBLY ASSERT]\033[0m" <<
-                            "        " <<
-                            "        " <<
-                            "    " << "\x1B[36mERASE CONTEXT\033[0m \x1B[90" << (m_context_active->name().empty() ? "<unnamed>" : m_context_active->name()) << "\033[0m" << std::endl;
-#endif // DF__SQF_RUNTIME__ASSEMBLY_DEBUG_ON_EXECUTE
-                        auto opt_val = m_context_active->pop_value(true);
-                        if (opt_val.has_value() && configuration().print_context_work_to_log_on_exit)
-                        {
-                            __logmsg(logmessage::runtime::ContextValuePrint(opt_val.value()));
-                        }
-                        m_contexts.erase(m_contexts.begin() + i);
-                        if (m_contexts.empty())
-                        {
-                            m_context_active = {};
-                            goto start_loop_exit;
-                        }
-                        i--;
-                    } break;
-                    case sqf::runtime::runtime::result::invalid:
-                    case sqf::runtime::runtime::result::action_error:
-                    case sqf::runtime::runtime::result::runtime_error:
+                        m_context_active = {};
                         goto start_loop_exit;
-                    case sqf::runtime::runtime::result::ok: /* empty */ break;
                     }
+                } break;
+                case sqf::runtime::runtime::result::invalid:
+                case sqf::runtime::runtime::result::action_error:
+                case sqf::runtime::runtime::result::runtime_error:
+                    // Keep the context scheduled in case execution is resumed.
+                    m_contexts_ready.push_front(m_context_active);
+                    goto start_loop_exit;
+                case sqf::runtime::runtime::result::ok:
+                    scheduler_enqueue(m_context_active);
+                    break;
                 }
             }
         start_loop_exit:
@@ -397,7 +567,7 @@ sqf::runtime::runtime::result sqf::runtime::runtime::execute(sqf::runtime::runti
             }
             if (m_is_exit_requested)
             {
-                m_contexts.clear();
+                contexts_clear();
                 m_context_active = {};
                 m_state = state::empty;
             }
@@ -437,7 +607,7 @@ sqf::runtime::runtime::result sqf::runtime::runtime::execute(sqf::runtime::runti
             }
             if (m_is_exit_requested)
             {
-                m_contexts.clear();
+                contexts_clear();
                 m_context_active = {};
                 m_state = state::empty;
             }
@@ -504,7 +674,7 @@ sqf::runtime::runtime::result sqf::runtime::runtime::execute(sqf::runtime::runti
             }
             if (m_is_exit_requested)
             {
-                m_contexts.clear();
+                contexts_clear();
                 m_context_active = {};
                 m_state = state::empty;
             }
@@ -555,7 +725,7 @@ sqf::runtime::runtime::result sqf::runtime::runtime::execute(sqf::runtime::runti
         {
             if (m_run_atomic.compare_exchange_weak(expected, true, std::memory_order::memory_order_seq_cst, std::memory_order::memory_order_seq_cst))
             {
-                m_contexts.clear();
+                contexts_clear();
                 m_context_active = {};
                 m_state = state::empty;
                 res = result::ok;
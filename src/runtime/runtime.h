@@ -13,6 +13,9 @@
 #include <chrono>
 #include <atomic>
 #include <vector>
+#include <deque>
+#include <queue>
+#include <unordered_map>
 #include <typeinfo>
 #include <typeindex>
 
@@ -85,13 +88,29 @@ namespace sqf::runtime
             /// </summary>
             bool print_context_work_to_log_on_exit;
 
+            /// <summary>
+            /// If true, instructions are executed one by one via their virtual execute method
+            /// instead of the lowered, flat representation (see sqf::runtime::bytecode).
+            /// Has no effect if compiled with DF__SQF_RUNTIME__DISABLE_BYTECODE.
+            /// </summary>
+            bool disable_bytecode;
+
+            /// <summary>
+            /// If true, the runtime clock (see runtime::now) skips ahead to the next
+            /// wakeup_timestamp whenever every context is suspended, instead of waiting for it.
+            /// time, diag_tickTime and sleep all follow that clock.
+            /// </summary>
+            bool virtual_time;
+
 
             runtime_conf() :
                 max_runtime(std::chrono::milliseconds::zero()),
                 disable_sleep(false),
                 enable_classname_check(true),
                 disable_networking(false),
-                print_context_work_to_log_on_exit(false)
+                print_context_work_to_log_on_exit(false),
+                disable_bytecode(false),
+                virtual_time(false)
             {}
         };
 
@@ -116,16 +135,75 @@ namespace sqf::runtime
     private:
         std::vector<sqf::runtime::diagnostics::breakpoint> m_breakpoints;
         sqf::runtime::diagnostics::breakpoint m_last_breakpoint_hit;
+
+        // Index over all enabled breakpoints, rebuilt lazily once m_breakpoints_dirty is set.
+        // Files are interned into ids so that a lookup is two hash-lookups at most.
+        std::unordered_map<std::string, size_t> m_breakpoint_files;
+        std::unordered_map<size_t, std::vector<std::pair<size_t, size_t>>> m_breakpoint_lines;
+        bool m_breakpoints_dirty;
+        bool m_breakpoints_armed;
+
+        void breakpoints_reindex()
+        {
+            m_breakpoint_files.clear();
+            m_breakpoint_lines.clear();
+            for (size_t i = 0; i < m_breakpoints.size(); i++)
+            {
+                const auto& bp = m_breakpoints[i];
+                if (!bp.is_enabled()) { continue; }
+                auto file_id = m_breakpoint_files.emplace(std::string(bp.file()), m_breakpoint_files.size()).first->second;
+                m_breakpoint_lines[bp.line()].emplace_back(file_id, i);
+            }
+            m_breakpoints_armed = !m_breakpoint_lines.empty();
+            m_breakpoints_dirty = false;
+        }
     public:
         using breakpoints_iterator = std::vector<sqf::runtime::diagnostics::breakpoint>::iterator;
         const std::vector<sqf::runtime::diagnostics::breakpoint>& breakpoints() const { return m_breakpoints; }
-        std::vector<sqf::runtime::diagnostics::breakpoint>& breakpoints() { return m_breakpoints; }
+        // Handing out mutable access invalidates the breakpoint index.
+        std::vector<sqf::runtime::diagnostics::breakpoint>& breakpoints() { m_breakpoints_dirty = true; return m_breakpoints; }
+
+        breakpoints_iterator breakpoints_begin() { m_breakpoints_dirty = true; return m_breakpoints.begin(); }
+        breakpoints_iterator breakpoints_end() { m_breakpoints_dirty = true; return m_breakpoints.end(); }
+        void erase(breakpoints_iterator from, breakpoints_iterator to) { m_breakpoints.erase(from, to); m_breakpoints_dirty = true; }
+        void erase(breakpoints_iterator iterator) { m_breakpoints.erase(iterator); m_breakpoints_dirty = true; }
+        void push_back(sqf::runtime::diagnostics::breakpoint bp) { m_breakpoints.push_back(bp); m_breakpoints_dirty = true; }
 
-        breakpoints_iterator breakpoints_begin() { return m_breakpoints.begin(); }
-        breakpoints_iterator breakpoints_end() { return m_breakpoints.end(); }
-        void erase(breakpoints_iterator from, breakpoints_iterator to) { m_breakpoints.erase(from, to); }
-        void erase(breakpoints_iterator iterator) { m_breakpoints.erase(iterator); }
-        void push_back(sqf::runtime::diagnostics::breakpoint bp) { m_breakpoints.push_back(bp); }
+        /// <summary>
+        /// Returns true if at least one enabled breakpoint exists.
+        /// Cheap enough to be checked for every instruction.
+        /// </summary>
+        bool breakpoints_armed()
+        {
+            if (m_breakpoints_dirty) { breakpoints_reindex(); }
+            return m_breakpoints_armed;
+        }
+        /// <summary>
+        /// Returns the enabled breakpoint matching the provided diag_info or nullptr if there is none.
+        /// </summary>
+        const sqf::runtime::diagnostics::breakpoint* breakpoint_at(const sqf::runtime::diagnostics::diag_info& dinf)
+        {
+            return breakpoint_at(dinf.line, dinf.path.physical);
+        }
+        /// <summary>
+        /// Returns the enabled breakpoint matching the provided line and physical path or nullptr if there is none.
+        /// </summary>
+        const sqf::runtime::diagnostics::breakpoint* breakpoint_at(size_t line, std::string_view physical)
+        {
+            if (!breakpoints_armed()) { return nullptr; }
+            auto line_it = m_breakpoint_lines.find(line);
+            if (line_it == m_breakpoint_lines.end()) { return nullptr; }
+            auto file_it = m_breakpoint_files.find(std::string(physical));
+            if (file_it == m_breakpoint_files.end()) { return nullptr; }
+            for (const auto& [file_id, index] : line_it->second)
+            {
+                if (file_id == file_it->second)
+                {
+                    return &m_breakpoints[index];
+                }
+            }
+            return nullptr;
+        }
 
         void breakpoint_hit(sqf::runtime::diagnostics::breakpoint breakpoint) { m_last_breakpoint_hit = breakpoint; m_is_halt_requested = true; }
 
@@ -172,7 +250,51 @@ namespace sqf::runtime
         std::unordered_map<std::string, std::vector<sqf::runtime::sqfop_unary::cwref>> m_operators_by_name_unary;
 
         std::unordered_map<sqf::runtime::sqfop_nular::key, sqf::runtime::sqfop_nular> m_operators_nular;
+
+        // Operators by sqfop_id, used to build the dispatch tables below.
+        std::vector<std::vector<const sqf::runtime::sqfop_binary*>> m_operators_by_id_binary;
+        std::vector<std::vector<const sqf::runtime::sqfop_unary*>> m_operators_by_id_unary;
+        std::vector<const sqf::runtime::sqfop_nular*> m_operators_by_id_nular;
+
+        // Dense dispatch tables, lazily built per sqfop_id.
+        // Binary tables are indexed by [left_type * types + right_type], unary tables by [right_type].
+        // Input types are already resolved against sqf::types::t_any() fallbacks.
+        template<class TOperator>
+        struct sqfop_dispatch_table
+        {
+            size_t types;
+            std::vector<const TOperator*> operators;
+        };
+        std::vector<sqfop_dispatch_table<sqf::runtime::sqfop_binary>> m_dispatch_binary;
+        std::vector<sqfop_dispatch_table<sqf::runtime::sqfop_unary>> m_dispatch_unary;
+
+        void sqfop_dispatch_build(sqf::runtime::sqfop_id id, sqfop_dispatch_table<sqf::runtime::sqfop_binary>& table);
+        void sqfop_dispatch_build(sqf::runtime::sqfop_id id, sqfop_dispatch_table<sqf::runtime::sqfop_unary>& table);
+
+        static inline std::atomic<size_t> s_sqfop_generation_counter{ 0 };
+        size_t m_sqfop_generation;
     public:
+        struct sqfop_cache_statistics
+        {
+            size_t hits;
+            size_t misses;
+        };
+    private:
+        sqfop_cache_statistics m_sqfop_cache_statistics;
+        void sqfop_generation_bump() { m_sqfop_generation = ++s_sqfop_generation_counter; }
+    public:
+        /// <summary>
+        /// Identifies the current set of registered operators.
+        /// Changes whenever an operator gets registered and is unique across runtime instances,
+        /// allowing inline caches of call instructions to detect stale entries.
+        /// </summary>
+        size_t sqfop_generation() const { return m_sqfop_generation; }
+        /// <summary>
+        /// Hit and miss counters of the per-instruction operator inline caches.
+        /// </summary>
+        sqfop_cache_statistics& sqfop_cache_stats() { return m_sqfop_cache_statistics; }
+        const sqfop_cache_statistics& sqfop_cache_stats() const { return m_sqfop_cache_statistics; }
+
         using sqfop_binary_iterator = std::unordered_map<sqf::runtime::sqfop_binary::key, sqf::runtime::sqfop_binary>::const_iterator;
         using sqfop_unary_iterator = std::unordered_map<sqf::runtime::sqfop_unary::key, sqf::runtime::sqfop_unary>::const_iterator;
         using sqfop_nular_iterator = std::unordered_map<sqf::runtime::sqfop_nular::key, sqf::runtime::sqfop_nular>::const_iterator;
@@ -189,8 +311,36 @@ namespace sqf::runtime
         }
         void register_sqfop(sqf::runtime::sqfop_binary op)
         {
-            m_operators_binary.insert({ op.get_key(), op });
+            auto res = m_operators_binary.insert({ op.get_key(), op });
             m_operators_by_name_binary[std::string(op.name())].push_back(m_operators_binary[op.get_key()]);
+            if (res.second)
+            {
+                if (m_operators_by_id_binary.size() <= op.id()) { m_operators_by_id_binary.resize(op.id() + 1); }
+                m_operators_by_id_binary[op.id()].push_back(&res.first->second);
+                if (m_dispatch_binary.size() > op.id()) { m_dispatch_binary[op.id()] = {}; }
+            }
+            sqfop_generation_bump();
+        }
+        /// <summary>
+        /// Resolves the binary operator for the provided input types, respecting sqf::types::t_any() fallbacks.
+        /// </summary>
+        /// <returns>The operator or nullptr if no operator matches.</returns>
+        const sqf::runtime::sqfop_binary* sqfop_resolve(sqf::runtime::sqfop_id id, sqf::runtime::type left_type, sqf::runtime::type right_type)
+        {
+            if (id >= m_dispatch_binary.size())
+            {
+                if (id >= m_operators_by_id_binary.size()) { return nullptr; }
+                m_dispatch_binary.resize(m_operators_by_id_binary.size());
+            }
+            auto& table = m_dispatch_binary[id];
+            size_t l = left_type;
+            size_t r = right_type;
+            if (l >= table.types || r >= table.types)
+            {
+                sqfop_dispatch_build(id, table);
+                if (l >= table.types || r >= table.types) { return nullptr; }
+            }
+            return table.operators[l * table.types + r];
         }
 
         sqfop_unary_iterator sqfop_unary_begin() const { return m_operators_unary.begin(); }
@@ -205,8 +355,35 @@ namespace sqf::runtime
         }
         void register_sqfop(sqf::runtime::sqfop_unary op)
         {
-            m_operators_unary.insert({ op.get_key(), op });
+            auto res = m_operators_unary.insert({ op.get_key(), op });
             m_operators_by_name_unary[std::string(op.name())].push_back(m_operators_unary[op.get_key()]);
+            if (res.second)
+            {
+                if (m_operators_by_id_unary.size() <= op.id()) { m_operators_by_id_unary.resize(op.id() + 1); }
+                m_operators_by_id_unary[op.id()].push_back(&res.first->second);
+                if (m_dispatch_unary.size() > op.id()) { m_dispatch_unary[op.id()] = {}; }
+            }
+            sqfop_generation_bump();
+        }
+        /// <summary>
+        /// Resolves the unary operator for the provided input type, respecting sqf::types::t_any() fallbacks.
+        /// </summary>
+        /// <returns>The operator or nullptr if no operator matches.</returns>
+        const sqf::runtime::sqfop_unary* sqfop_resolve(sqf::runtime::sqfop_id id, sqf::runtime::type right_type)
+        {
+            if (id >= m_dispatch_unary.size())
+            {
+                if (id >= m_operators_by_id_unary.size()) { return nullptr; }
+                m_dispatch_unary.resize(m_operators_by_id_unary.size());
+            }
+            auto& table = m_dispatch_unary[id];
+            size_t r = right_type;
+            if (r >= table.types)
+            {
+                sqfop_dispatch_build(id, table);
+                if (r >= table.types) { return nullptr; }
+            }
+            return table.operators[r];
         }
 
         sqfop_nular_iterator sqfop_nular_begin() const { return m_operators_nular.begin(); }
@@ -220,7 +397,21 @@ namespace sqf::runtime
         }
         void register_sqfop(sqf::runtime::sqfop_nular op)
         {
-            m_operators_nular.insert({ op.get_key(), op });
+            auto res = m_operators_nular.insert({ op.get_key(), op });
+            if (res.second)
+            {
+                if (m_operators_by_id_nular.size() <= op.id()) { m_operators_by_id_nular.resize(op.id() + 1, nullptr); }
+                m_operators_by_id_nular[op.id()] = &res.first->second;
+            }
+            sqfop_generation_bump();
+        }
+        /// <summary>
+        /// Resolves the nular operator with the provided id.
+        /// </summary>
+        /// <returns>The operator or nullptr if no operator matches.</returns>
+        const sqf::runtime::sqfop_nular* sqfop_resolve(sqf::runtime::sqfop_id id) const
+        {
+            return id < m_operators_by_id_nular.size() ? m_operators_by_id_nular[id] : nullptr;
         }
 
 #pragma endregion
@@ -286,8 +477,62 @@ namespace sqf::runtime
 #pragma region Runtime-Context Handling
 
             private:
+                struct context_wakeup
+                {
+                    std::chrono::system_clock::time_point timestamp;
+                    std::shared_ptr<sqf::runtime::context> context;
+                    bool operator>(const context_wakeup& other) const { return timestamp > other.timestamp; }
+                };
                 std::vector<std::shared_ptr<sqf::runtime::context>> m_contexts;
                 std::shared_ptr<sqf::runtime::context> m_context_active;
+                // Contexts ready to be executed by action::start, in round-robin order.
+                std::deque<std::shared_ptr<sqf::runtime::context>> m_contexts_ready;
+                // Suspended contexts, ordered by their wakeup_timestamp (earliest first).
+                std::priority_queue<context_wakeup, std::vector<context_wakeup>, std::greater<context_wakeup>> m_contexts_sleeping;
+
+                /// <summary>
+                /// Rebuilds the ready queue and the sleeping heap from m_contexts.
+                /// </summary>
+                void scheduler_reset()
+                {
+                    m_contexts_ready.clear();
+                    m_contexts_sleeping = {};
+                    for (auto& context : m_contexts)
+                    {
+                        scheduler_enqueue(context);
+                    }
+                }
+                void scheduler_enqueue(std::shared_ptr<sqf::runtime::context> context)
+                {
+                    if (context->suspended())
+                    {
+                        auto timestamp = context->wakeup_timestamp();
+                        m_contexts_sleeping.push({ timestamp, std::move(context) });
+                    }
+                    else
+                    {
+                        m_contexts_ready.push_back(std::move(context));
+                    }
+                }
+                /// <summary>
+                /// Moves every sleeping context that is due at the provided time into the ready queue.
+                /// </summary>
+                void scheduler_wakeup(std::chrono::system_clock::time_point now)
+                {
+                    while (!m_contexts_sleeping.empty() && m_contexts_sleeping.top().timestamp <= now)
+                    {
+                        auto context = m_contexts_sleeping.top().context;
+                        m_contexts_sleeping.pop();
+                        context->unsuspend();
+                        m_contexts_ready.push_back(std::move(context));
+                    }
+                }
+                void contexts_clear()
+                {
+                    m_contexts.clear();
+                    m_contexts_ready.clear();
+                    m_contexts_sleeping = {};
+                }
 
             public:
                 using context_iterator = std::vector<std::shared_ptr<sqf::runtime::context>>::iterator;
@@ -298,7 +543,13 @@ namespace sqf::runtime
                     else  { m_context_active = m_contexts.front(); return *m_context_active; }
                 };
                 std::shared_ptr<sqf::runtime::context> context_active_as_shared() const { return m_context_active; };
-                std::weak_ptr<context> context_create() { auto ptr = std::make_shared<context>(); m_contexts.push_back(ptr); return ptr; }
+                std::weak_ptr<context> context_create() { auto ptr = std::make_shared<context>(); m_contexts.push_back(ptr); m_contexts_ready.push_back(ptr); return ptr; }
+
+                /// <summary>
+                /// The longest time action::start blocks at once while waiting for a suspended context.
+                /// Bounds the delay until exit requests from other threads are noticed.
+                /// </summary>
+                static constexpr std::chrono::milliseconds scheduler_idle_slice = std::chrono::milliseconds(50);
                 context_iterator context_begin() { return m_contexts.begin(); }
                 context_iterator context_end() { return m_contexts.end(); }
 
@@ -309,6 +560,12 @@ namespace sqf::runtime
     private:
         runtime_conf m_configuration;
         std::chrono::system_clock::time_point m_runtime_timestamp;
+        // Same as m_runtime_timestamp, but monotonic. Used to enforce runtime_conf::max_runtime.
+        std::chrono::steady_clock::time_point m_runtime_timestamp_steady;
+        // Instructions left until max_runtime is checked again.
+        size_t m_max_runtime_budget;
+        // Time skipped by the scheduler if runtime_conf::virtual_time is set.
+        std::chrono::system_clock::duration m_virtual_time_offset;
         bool m_runtime_error;
 
         std::chrono::system_clock::time_point m_created_timestamp;
@@ -330,10 +587,17 @@ namespace sqf::runtime
             m_run_atomic(false),
             m_breakpoints(),
             m_last_breakpoint_hit(~((size_t)0), {}),
+            m_breakpoints_dirty(false),
+            m_breakpoints_armed(false),
+            m_sqfop_generation(++s_sqfop_generation_counter),
+            m_sqfop_cache_statistics({ 0, 0 }),
             m_default_scope_key("default"),
             m_evaluate_halt(false),
             m_configuration(config),
             m_runtime_timestamp(std::chrono::system_clock::now()),
+            m_runtime_timestamp_steady(std::chrono::steady_clock::now()),
+            m_max_runtime_budget(0),
+            m_virtual_time_offset(std::chrono::system_clock::duration::zero()),
             m_runtime_error(false),
             m_created_timestamp(m_runtime_timestamp),
             m_confighost(),
@@ -346,9 +610,50 @@ namespace sqf::runtime
 
 
         sqf::runtime::runtime::result execute(sqf::runtime::runtime::action action);
-        const sqf::runtime::runtime::runtime_conf configuration() const { return m_configuration; }
+        const sqf::runtime::runtime::runtime_conf& configuration() const { return m_configuration; }
+        sqf::runtime::runtime::runtime_conf& configuration() { return m_configuration; }
         std::chrono::system_clock::time_point runtime_timestamp() { return m_runtime_timestamp; }
-        void runtime_timestamp_reset() { m_runtime_timestamp = std::chrono::system_clock::now(); }
+        /// <summary>
+        /// The start of the runtime on the steady wall clock, which is not affected by runtime_conf::virtual_time.
+        /// </summary>
+        std::chrono::steady_clock::time_point runtime_timestamp_steady() const { return m_runtime_timestamp_steady; }
+        void runtime_timestamp_reset()
+        {
+            m_runtime_timestamp = std::chrono::system_clock::now();
+            m_runtime_timestamp_steady = std::chrono::steady_clock::now();
+            m_max_runtime_budget = 0;
+            m_virtual_time_offset = std::chrono::system_clock::duration::zero();
+        }
+
+        /// <summary>
+        /// The current time of the runtime clock.
+        /// Equals the wall clock unless runtime_conf::virtual_time is set, in which case
+        /// all time skipped while waiting for suspended contexts is added.
+        /// </summary>
+        std::chrono::system_clock::time_point now() const { return std::chrono::system_clock::now() + m_virtual_time_offset; }
+
+        /// <summary>
+        /// The number of instructions executed between two checks of runtime_conf::max_runtime.
+        /// </summary>
+        static constexpr size_t max_runtime_check_interval = 1024;
+        /// <summary>
+        /// Returns true if runtime_conf::max_runtime is set and was exceeded.
+        /// Only consults the clock every max_runtime_check_interval calls.
+        /// </summary>
+        bool max_runtime_exceeded()
+        {
+            if (m_max_runtime_budget > 0)
+            {
+                m_max_runtime_budget--;
+                return false;
+            }
+            m_max_runtime_budget = max_runtime_check_interval - 1;
+            if (m_configuration.max_runtime == std::chrono::milliseconds::zero())
+            {
+                return false;
+            }
+            return std::chrono::steady_clock::now() - m_runtime_timestamp_steady > m_configuration.max_runtime;
+        }
 
         sqf::runtime::confighost& confighost() { return m_confighost; }
 
@@ -5,10 +5,73 @@
 #include <string>
 #include <string_view>
 #include <functional>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <algorithm>
+#include <cctype>
 
 namespace sqf::runtime
 {
     class runtime;
+    using sqfop_id = size_t;
+
+    /// <summary>
+    /// Process-wide symbol table, interning operator names into dense integer ids.
+    /// Ids are shared across runtime instances and never change once assigned,
+    /// thus instructions may store them safely.
+    /// </summary>
+    class sqfop_symbols
+    {
+    public:
+        static const sqfop_id invalid_id = ~((sqfop_id)0);
+    private:
+        struct storage
+        {
+            std::mutex mutex;
+            std::unordered_map<std::string, sqfop_id> ids;
+            std::deque<std::string> names;
+        };
+        static storage& get_storage()
+        {
+            static storage s;
+            return s;
+        }
+    public:
+        /// <summary>
+        /// Receives the id of the provided operator name, creating it if it does not exist yet.
+        /// Operator names are case-insensitive.
+        /// </summary>
+        static sqfop_id intern(std::string name)
+        {
+            std::transform(name.begin(), name.end(), name.begin(), [](char& c) { return (char)std::tolower((int)c); });
+            auto& s = get_storage();
+            std::lock_guard<std::mutex> lock(s.mutex);
+            auto res = s.ids.find(name);
+            if (res != s.ids.end())
+            {
+                return res->second;
+            }
+            auto id = s.names.size();
+            s.names.push_back(name);
+            s.ids[name] = id;
+            return id;
+        }
+        static std::string name(sqfop_id id)
+        {
+            auto& s = get_storage();
+            std::lock_guard<std::mutex> lock(s.mutex);
+            return id < s.names.size() ? s.names[id] : std::string();
+        }
+        static size_t size()
+        {
+            auto& s = get_storage();
+            std::lock_guard<std::mutex> lock(s.mutex);
+            return s.names.size();
+        }
+    };
+
     class sqfop_binary
     {
     public:
@@ -31,10 +94,12 @@ namespace sqf::runtime
         std::string m_description;
         callback m_callback;
         short m_precedence;
+        sqfop_id m_id;
     public:
-        sqfop_binary() = default;
-        sqfop_binary(short precedence, key key, std::string description, callback callback) : m_key(key), m_description(description), m_callback(callback), m_precedence(precedence) {}
+        sqfop_binary() : m_key(), m_description(), m_callback(nullptr), m_precedence(0), m_id(sqfop_symbols::invalid_id) {}
+        sqfop_binary(short precedence, key key, std::string description, callback callback) : m_key(key), m_description(description), m_callback(callback), m_precedence(precedence), m_id(sqfop_symbols::intern(key.name)) {}
         std::string_view name() const { return m_key.name; }
+        sqfop_id id() const { return m_id; }
         std::string_view description() const { return m_description; }
         short precedence() const { return m_precedence; }
         sqf::runtime::type left_type() const { return m_key.left_type; }
@@ -63,10 +128,12 @@ namespace sqf::runtime
         std::string m_description;
 
         callback m_callback;
+        sqfop_id m_id;
     public:
-        sqfop_unary() = default;
-        sqfop_unary(key key, std::string description, callback callback) : m_key(key), m_description(description), m_callback(callback) {}
+        sqfop_unary() : m_key(), m_description(), m_callback(nullptr), m_id(sqfop_symbols::invalid_id) {}
+        sqfop_unary(key key, std::string description, callback callback) : m_key(key), m_description(description), m_callback(callback), m_id(sqfop_symbols::intern(key.name)) {}
         std::string_view name() const { return m_key.name; }
+        sqfop_id id() const { return m_id; }
         std::string_view description() const { return m_description; }
         sqf::runtime::type right_type() const { return m_key.right_type; }
         value execute(sqf::runtime::runtime& vm, value::cref right) const { return m_callback(vm, right); }
@@ -92,14 +159,74 @@ namespace sqf::runtime
         std::string m_description;
 
         callback m_callback;
+        sqfop_id m_id;
     public:
-        sqfop_nular() = default;
-        sqfop_nular(key key, std::string description, callback callback) : m_key(key), m_description(description), m_callback(callback) {}
+        sqfop_nular() : m_key(), m_description(), m_callback(nullptr), m_id(sqfop_symbols::invalid_id) {}
+        sqfop_nular(key key, std::string description, callback callback) : m_key(key), m_description(description), m_callback(callback), m_id(sqfop_symbols::intern(key.name)) {}
         std::string_view name() const { return m_key.name; }
+        sqfop_id id() const { return m_id; }
         std::string_view description() const { return m_description; }
         value execute(sqf::runtime::runtime& vm) const { return m_callback(vm); }
         key get_key() const { return m_key; }
     };
+    /// <summary>
+    /// Small polymorphic inline cache, attached to a single call instruction.
+    /// Maps the argument types last seen by that instruction to the resolved operator,
+    /// allowing the instruction to skip the (string-hashing) operator lookup.
+    /// </summary>
+    /// <remarks>
+    /// Entries are only valid for the sqfop_generation they were created with.
+    /// Once the cache is full, the oldest entry gets replaced.
+    /// </remarks>
+    template<class TOperator, size_t TSize = 4>
+    class sqfop_inline_cache
+    {
+    private:
+        struct entry
+        {
+            unsigned short left_type;
+            unsigned short right_type;
+            const TOperator* op;
+        };
+        std::array<entry, TSize> m_entries;
+        size_t m_size;
+        size_t m_next;
+        size_t m_generation;
+    public:
+        sqfop_inline_cache() : m_entries(), m_size(0), m_next(0), m_generation(0) {}
+
+        const TOperator* find(size_t generation, unsigned short left_type, unsigned short right_type) const
+        {
+            if (generation != m_generation)
+            {
+                return nullptr;
+            }
+            for (size_t i = 0; i < m_size; i++)
+            {
+                auto& it = m_entries[i];
+                if (it.left_type == left_type && it.right_type == right_type)
+                {
+                    return it.op;
+                }
+            }
+            return nullptr;
+        }
+        void insert(size_t generation, unsigned short left_type, unsigned short right_type, const TOperator* op)
+        {
+            if (generation != m_generation)
+            {
+                m_generation = generation;
+                m_size = 0;
+                m_next = 0;
+            }
+            m_entries[m_next] = { left_type, right_type, op };
+            m_next = (m_next + 1) % TSize;
+            if (m_size < TSize)
+            {
+                m_size++;
+            }
+        }
+    };
     namespace sqfop
     {
         /// <summary>
@@ -68,6 +68,12 @@ namespace sqf
                 return m_value == (short)(T());
             }
 
+            /// <summary>
+            /// The highest type value assigned so far.
+            /// Type values are dense, starting at 1.
+            /// </summary>
+            static unsigned short max_value() { return s_type_value; }
+
             static const std::unordered_map<std::string, type>& typemap()
             {
                 auto& map = typemap_nc();
@@ -100,6 +106,11 @@ namespace sqf
                 }
             }
         };
+
+        // SCALAR and BOOL are declared here (instead of next to their data types)
+        // as sqf::runtime::value stores them inline and thus needs to know them.
+        struct t_scalar : public type::extend<t_scalar> { t_scalar() : extend() {} static const std::string name() { return "SCALAR"; } };
+        struct t_boolean : public type::extend<t_boolean> { t_boolean() : extend() {} static const std::string name() { return "BOOL"; } };
     }
     namespace types
     {
@@ -0,0 +1,34 @@
+#include "value.h"
+#include "d_scalar.h"
+#include "d_boolean.h"
+
+std::shared_ptr<sqf::runtime::data> sqf::runtime::value::box() const
+{
+    switch (m_storage)
+    {
+    case storage::scalar: return std::make_shared<sqf::types::d_scalar>(m_scalar);
+    case storage::boolean: return std::make_shared<sqf::types::d_boolean>(m_boolean);
+    default: return m_data;
+    }
+}
+
+void sqf::runtime::value::unbox(std::shared_ptr<sqf::runtime::data> d)
+{
+    if (d)
+    {
+        auto t = d->type();
+        if (t == sqf::runtime::t_scalar())
+        {
+            m_storage = storage::scalar;
+            m_scalar = std::static_pointer_cast<sqf::types::d_scalar>(d)->value();
+            return;
+        }
+        else if (t == sqf::runtime::t_boolean())
+        {
+            m_storage = storage::boolean;
+            m_boolean = std::static_pointer_cast<sqf::types::d_boolean>(d)->value();
+            return;
+        }
+    }
+    m_data = std::move(d);
+}
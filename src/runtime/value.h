@@ -15,51 +15,163 @@ namespace sqf
     {
         template<typename T>
         inline std::shared_ptr<sqf::runtime::data> to_data(T t);
+        class d_scalar;
+        class d_boolean;
     }
     namespace runtime
     {
+        /// <summary>
+        /// A single SQF value.
+        /// SCALAR and BOOL values are stored inline (no allocation), every other type
+        /// is boxed inside of a std::shared_ptr. nil is represented as an empty box.
+        /// Inline values get boxed lazily when their sqf::runtime::data is requested
+        /// via the pointer returning accessors (data(), data&lt;T&gt;(), data_try&lt;T&gt;()).
+        /// </summary>
         class value
         {
         public:
             using cwref = std::reference_wrapper<const value>;
             using cref = const value&;
         private:
+            enum class storage : unsigned char
+            {
+                boxed,
+                scalar,
+                boolean
+            };
             std::shared_ptr<sqf::runtime::data> m_data;
+            storage m_storage;
+            union
+            {
+                float m_scalar;
+                bool m_boolean;
+            };
+
+            /// <summary>
+            /// Creates a new sqf::runtime::data instance for inline values.
+            /// </summary>
+            std::shared_ptr<sqf::runtime::data> box() const;
+            /// <summary>
+            /// Takes over the provided data, storing it inline if possible.
+            /// </summary>
+            void unbox(std::shared_ptr<sqf::runtime::data> d);
         public:
-            constexpr value() noexcept {}
+            constexpr value() noexcept : m_storage(storage::boxed), m_scalar(0) {}
 
             template<typename T>
-            value(T t) : m_data(::sqf::types::to_data<T>(t)) { }
+            value(T t) : m_storage(storage::boxed), m_scalar(0)
+            {
+                if constexpr (std::is_same<T, bool>::value)
+                {
+                    m_storage = storage::boolean;
+                    m_boolean = t;
+                }
+                else if constexpr (std::is_arithmetic<T>::value && !std::is_same<T, char>::value)
+                {
+                    m_storage = storage::scalar;
+                    m_scalar = (float)t;
+                }
+                else
+                {
+                    m_data = ::sqf::types::to_data<T>(t);
+                }
+            }
             template<typename T>
-            value(std::shared_ptr<T> d) : m_data(std::move(d)) { }
+            value(std::shared_ptr<T> d) : m_storage(storage::boxed), m_scalar(0)
+            {
+                if constexpr (std::is_same<T, sqf::types::d_scalar>::value)
+                {
+                    if (d)
+                    {
+                        m_storage = storage::scalar;
+                        m_scalar = d->value();
+                    }
+                }
+                else if constexpr (std::is_same<T, sqf::types::d_boolean>::value)
+                {
+                    if (d)
+                    {
+                        m_storage = storage::boolean;
+                        m_boolean = d->value();
+                    }
+                }
+                else if constexpr (std::is_same<T, sqf::runtime::data>::value)
+                {
+                    unbox(std::move(d));
+                }
+                else
+                {
+                    m_data = std::move(d);
+                }
+            }
 
             template<class T>
             bool is() const
             {
                 static_assert(std::is_base_of<sqf::runtime::type, T>::value, "value::is<T>() can only be used with sqf::runtime::type types.");
-                return type() == T();
+                if constexpr (std::is_same<T, sqf::runtime::t_scalar>::value)
+                {
+                    return m_storage == storage::scalar;
+                }
+                else if constexpr (std::is_same<T, sqf::runtime::t_boolean>::value)
+                {
+                    return m_storage == storage::boolean;
+                }
+                else
+                {
+                    return type() == T();
+                }
             }
             bool is(sqf::runtime::type t) const
             {
                 return this->operator sqf::runtime::type() == t;
             }
-            bool empty() const { return !m_data.get(); }
+            bool empty() const { return m_storage == storage::boxed && !m_data.get(); }
 
-            bool operator==(cref other) const { return (((bool)m_data.get()) && ((bool)other.m_data.get()) && m_data->equals(other.m_data)) || (!((bool)m_data.get()) && !((bool)other.m_data.get())); }
+            /// <summary>
+            /// Compares this value against the other value.
+            /// Two nil values are considered equal.
+            /// If invariant false, comparison should be case-sensitive.
+            /// </summary>
+            bool equals(cref other, bool invariant = false) const
+            {
+                if (m_storage != other.m_storage) { return false; }
+                switch (m_storage)
+                {
+                case storage::scalar: return m_scalar == other.m_scalar;
+                case storage::boolean: return m_boolean == other.m_boolean;
+                default:
+                    if (!m_data.get() || !other.m_data.get())
+                    {
+                        return !m_data.get() && !other.m_data.get();
+                    }
+                    return m_data->equals(other.m_data, invariant);
+                }
+            }
+            bool operator==(cref other) const { return equals(other); }
             bool operator!=(cref other) const { return !(*this == other); }
 
 
             /// <summary>
             /// Returns the m_data member.
+            /// For inline values (SCALAR, BOOL), a new sqf::runtime::data instance is created.
             /// </summary>
             /// <returns></returns>
-            std::shared_ptr<sqf::runtime::data> data() const { return m_data; }
+            std::shared_ptr<sqf::runtime::data> data() const { return m_storage == storage::boxed ? m_data : box(); }
 
-            std::string to_string_sqf() const { return m_data ? m_data->to_string_sqf() : std::string("nil"); }
-            std::string to_string() const { return m_data ? m_data->to_string() : std::string(); }
+            std::string to_string_sqf() const { return m_storage != storage::boxed ? box()->to_string_sqf() : m_data ? m_data->to_string_sqf() : std::string("nil"); }
+            std::string to_string() const { return m_storage != storage::boxed ? box()->to_string() : m_data ? m_data->to_string() : std::string(); }
 
-            explicit operator sqf::runtime::type() const { return m_data ? m_data->type() : sqf::types::t_nothing(); };
-            sqf::runtime::type type() const { return m_data ? m_data->type() : sqf::types::t_nothing(); }
+            explicit operator sqf::runtime::type() const { return type(); };
+            sqf::runtime::type type() const
+            {
+                switch (m_storage)
+                {
+                case storage::scalar: return sqf::runtime::t_scalar();
+                case storage::boolean: return sqf::runtime::t_boolean();
+                default: return m_data ? m_data->type() : sqf::types::t_nothing();
+                }
+            }
 
             /// <summary>
             /// Attempts to convert the data-member to the provided data type.
@@ -73,32 +185,38 @@ namespace sqf
             template <class T>
             std::shared_ptr<T> data_try() const {
                 static_assert(std::is_base_of<sqf::runtime::data, T>::value, "value::data_try_as<T>() can only convert to sqf::runtime::data types");
-                return std::dynamic_pointer_cast<T>(m_data);
+                return std::dynamic_pointer_cast<T>(data());
             }
             template <class T, typename TValue>
             std::optional<TValue> data_try() const {
-                auto conv = data_try<T>();
-                if (conv)
-                {
-                    return (TValue)*conv;
-                }
-                else
+                if constexpr (std::is_same<T, sqf::types::d_scalar>::value)
                 {
+                    if (m_storage == storage::scalar) { return (TValue)m_scalar; }
                     return {};
                 }
-            }
-            template <class T, typename TValue>
-            TValue data_try(TValue def) const {
-                auto conv = data_try<T>();
-                if (conv)
+                else if constexpr (std::is_same<T, sqf::types::d_boolean>::value)
                 {
-                    return (TValue)*conv;
+                    if (m_storage == storage::boolean) { return (TValue)m_boolean; }
+                    return {};
                 }
                 else
                 {
-                    return def;
+                    auto conv = data_try<T>();
+                    if (conv)
+                    {
+                        return (TValue)*conv;
+                    }
+                    else
+                    {
+                        return {};
+                    }
                 }
             }
+            template <class T, typename TValue>
+            TValue data_try(TValue def) const {
+                auto conv = data_try<T, TValue>();
+                return conv.has_value() ? *conv : def;
+            }
             /// <summary>
             /// Converts the data-member to the provided data type.
             /// Will use std::static_pointer_cast.
@@ -111,15 +229,31 @@ namespace sqf
             template<class T>
             std::shared_ptr<T> data() const {
                 static_assert(std::is_base_of<sqf::runtime::data, T>::value, "value::data<T>() can only convert to sqf::runtime::data types");
-                return std::static_pointer_cast<T>(m_data);
+                return std::static_pointer_cast<T>(data());
             }
 
             template<class TData, typename TValue>
-            TValue data() const { return (TValue)(*data<TData>()); }
+            TValue data() const
+            {
+                if constexpr (std::is_same<TData, sqf::types::d_scalar>::value)
+                {
+                    if (m_storage == storage::scalar) { return (TValue)m_scalar; }
+                }
+                else if constexpr (std::is_same<TData, sqf::types::d_boolean>::value)
+                {
+                    if (m_storage == storage::boolean) { return (TValue)m_boolean; }
+                }
+                return (TValue)(*data<TData>());
+            }
 
             std::size_t hash() const
             {
-                return empty() ? 0 : m_data->hash();
+                switch (m_storage)
+                {
+                case storage::scalar: return std::hash<float>()(m_scalar);
+                case storage::boolean: return std::hash<bool>()(m_boolean);
+                default: return empty() ? 0 : m_data->hash();
+                }
             }
         };
     }
@@ -61,6 +61,47 @@ namespace sqf::runtime
 #endif // DF__SQF_RUNTIME__VALUE_SCOPE_DEBUG
             return m_map[variable_name];
         }
+
+        /// <summary>
+        /// Returns the passed variable name in the form used as key by value_scope.
+        /// Callers that access the same variable repeatedly (eg. opcodes) should compute
+        /// this once and use the *_key overloads below.
+        /// </summary>
+        static std::string to_key(std::string variable_name)
+        {
+            std::transform(variable_name.begin(), variable_name.end(), variable_name.begin(), [](char& c) { return (char)std::tolower((int)c); });
+            return variable_name;
+        }
+
+        /// <summary>
+        /// Looks up a variable by its already lowercased key (see to_key).
+        /// Returns nullptr if the variable does not exist in this scope.
+        /// </summary>
+        const sqf::runtime::value* find_key(const std::string& key) const
+        {
+            auto res = m_map.find(key);
+            return res == m_map.end() ? nullptr : &res->second;
+        }
+        /// <summary>
+        /// Looks up a variable by its already lowercased key (see to_key).
+        /// Returns nullptr if the variable does not exist in this scope.
+        /// </summary>
+        sqf::runtime::value* find_key(const std::string& key)
+        {
+            auto res = m_map.find(key);
+            return res == m_map.end() ? nullptr : &res->second;
+        }
+        /// <summary>
+        /// Receives a variable by its already lowercased key (see to_key),
+        /// creating it if it does not exist yet.
+        /// </summary>
+        sqf::runtime::value& at_key(const std::string& key) { return m_map[key]; }
+        /// <summary>
+        /// The number of variables in this scope. Variables are never removed individually,
+        /// hence a changed count tells that a variable was added (or the scope got cleared).
+        /// </summary>
+        size_t variable_count() const { return m_map.size(); }
+
         std::string_view scope_name() const { return m_scope_name; }
         void scope_name(std::string value) { m_scope_name = value; }
         void clear_value_scope() { m_map.clear(); }
@@ -26,4 +26,13 @@ class type_tests
     type_anytext_array[] = { any, fancy, text, should, be, accepted };
     type_scalar = 1;
     class type_class {};
-};
\ No newline at end of file
+};
+class CfgVehicles
+{
+    class All {};
+    class Land : All {};
+    class Air : All {};
+    class Car : Land {};
+    class Truck : Car {};
+    class Plane : Land {};
+};
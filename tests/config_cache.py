@@ -0,0 +1,129 @@
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+
+# Tests the config cache (--config-cache) and rapified configs (config.bin).
+# Usage: python tests/config_cache.py path/to/sqfvm
+
+sqfvm = os.path.abspath(sys.argv[1])
+current_dir = os.path.dirname(os.path.realpath(__file__))
+work_dir = tempfile.mkdtemp()
+cache = os.path.join(work_dir, 'cache.bin')
+failures = []
+
+def write(name, contents):
+    path = os.path.join(work_dir, name)
+    with open(path, 'wb') as f:
+        f.write(contents)
+    return path
+
+def run(config_files, code, *args):
+    command = [sqfvm, '-a', '-V', '--no-load-execdir', '-v', work_dir + '|/cache_tests', '--sqf', code]
+    for f in config_files:
+        command += ['-i', f]
+    command += list(args)
+    process = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    output = process.stdout.decode(errors='replace')
+    results = [line.split('[DIAG_LOG] ', 1)[1] for line in output.splitlines() if '[DIAG_LOG] ' in line]
+    state = 'loaded' if 'Loaded config files from cache' in output else 'wrote' if 'Wrote config files to cache' in output else 'none'
+    return process.returncode, state, results[-1] if results else None
+
+def check(name, actual, expected):
+    if actual != expected:
+        failures.append(name + ': expected ' + str(expected) + ', got ' + str(actual))
+
+def cached(name, config_files, code, expected_state, expected_result, *args):
+    check(name, run(config_files, code, '--config-cache', cache, *args), (0, expected_state, expected_result))
+
+
+# config.bin loads into the same tree as the config it got created from
+rapified_query = (
+    'private _c = configFile >> "rapified_tests"; diag_log ['
+    'getText (_c >> "base" >> "text"), getNumber (_c >> "base" >> "scalar"), getNumber (_c >> "base" >> "integer"),'
+    'getArray (_c >> "base" >> "array"), getNumber (_c >> "base" >> "nested" >> "value"),'
+    'getNumber (_c >> "derived" >> "integer"), getText (_c >> "derived" >> "text"), getArray (_c >> "derived" >> "array"),'
+    'isClass (_c >> "external"), count (_c >> "derived"), count (_c >> "base")];')
+rapified_expected = '[base,1.5,42,[1,two,[3,4.5]],1,7,base,[1,two,[3,4.5],5],true,3,5]'
+rapified_bin = os.path.join(current_dir, 'rapified', 'config.bin')
+check('config.cpp', run([os.path.join(current_dir, 'rapified', 'config.cpp')], rapified_query), (0, 'none', rapified_expected))
+check('config.bin', run([rapified_bin], rapified_query), (0, 'none', rapified_expected))
+
+# Class bodies referenced more than once are rejected
+with open(rapified_bin, 'rb') as f:
+    rapified = bytearray(f.read())
+derived = rapified.index(b'derived\0') + len(b'derived\0')
+struct.pack_into('<I', rapified, derived, struct.unpack_from('<I', rapified, rapified.index(b'base\0') + len(b'base\0'))[0])
+check('config.bin shared body', run([write('shared_body.bin', rapified)], rapified_query)[0] != 0, True)
+
+
+# Images read back from the cache match the freshly parsed configs
+config = write('config.cpp', b'#include "included.hpp"\nclass cache_tests { class base { text = "base"; values[] = { 1, { "two" } }; }; class child : base { value = VALUE; }; };\n')
+included = write('included.hpp', b'#define VALUE 1\n')
+config_files = [config, rapified_bin]
+query = (
+    'private _c = configFile >> "cache_tests"; diag_log ['
+    'getText (_c >> "child" >> "text"), getArray (_c >> "child" >> "values"), getNumber (_c >> "child" >> "value"),'
+    'configName inheritsFrom (_c >> "child"), isClass (_c >> "base"), getArray (configFile >> "rapified_tests" >> "derived" >> "array")];')
+expected = run(config_files, query)[2]
+check('fresh', expected, '[base,[1,[two]],1,cache_tests,true,[1,two,[3,4.5],5]]')
+cached('write', config_files, query, 'wrote', expected)
+cached('read', config_files, query, 'loaded', expected)
+
+# Changing the key (eg. defines) or a dependency invalidates the cache
+cached('define added', config_files, query, 'wrote', expected, '-D', 'UNUSED')
+cached('define kept', config_files, query, 'loaded', expected, '-D', 'UNUSED')
+cached('define removed', config_files, query, 'wrote', expected)
+os.utime(included, (0, 0))
+cached('dependency touched', config_files, query, 'loaded', expected) # Dependencies are compared by content, not by timestamp
+write('included.hpp', b'#define VALUE 2\n')
+cached('dependency changed', config_files, query, 'wrote', expected.replace(',1,cache_tests', ',2,cache_tests'))
+write('included.hpp', b'#define VALUE 1\n')
+cached('dependency restored', config_files, query, 'wrote', expected)
+
+
+# Truncated or corrupt caches are rejected (and rewritten)
+with open(cache, 'rb') as f:
+    valid = f.read()
+image = 8 + 8 + 4
+for _ in range(struct.unpack_from('<I', valid, 16)[0]):
+    image += 4 + struct.unpack_from('<I', valid, image)[0] + 8
+magic, version, names, containers, children, value_bytes, string_bytes = struct.unpack_from('<7I', valid, image)
+names_at = image + 28
+containers_at = names_at + 8 * names
+children_at = containers_at + 24 * containers
+
+def corrupt(name, offset, value):
+    data = bytearray(valid)
+    struct.pack_into('<I', data, offset, value)
+    return name, bytes(data)
+
+variants = [('truncated to ' + str(length), valid[:length]) for length in [0, 8, image, image + 20, children_at, len(valid) - 1]]
+variants += [
+    corrupt('image magic', image, 0),
+    corrupt('container count', image + 12, 0xFFFFFFF),
+    corrupt('name offset', names_at, 0xFFFFFFF),
+    corrupt('logical parent', containers_at + 24 + 4, containers),
+    corrupt('inherited parent', containers_at + 24 + 8, 0xFFFFFFF),
+    corrupt('children', containers_at + 12, children + 1),
+    corrupt('child id', children_at + 4, containers + 1),
+]
+valued = next(i for i in range(containers) if struct.unpack_from('<I', valid, containers_at + 24 * i + 20)[0] != 0xFFFFFFFF)
+variants.append(corrupt('value offset', containers_at + 24 * valued + 20, value_bytes))
+cyclic = bytearray(valid)
+struct.pack_into('<I', cyclic, containers_at + 24 * 1 + 8, 2)
+struct.pack_into('<I', cyclic, containers_at + 24 * 2 + 8, 1)
+variants.append(('inheritance cycle', bytes(cyclic)))
+for name, data in variants:
+    with open(cache, 'wb') as f:
+        f.write(data)
+    cached(name, config_files, query, 'wrote', expected)
+    cached(name + ' rewritten', config_files, query, 'loaded', expected)
+
+shutil.rmtree(work_dir)
+for failure in failures:
+    print(failure)
+print(('FAILED' if failures else 'PASSED') + ' (' + str(len(failures)) + ' failure(s))')
+sys.exit(1 if failures else 0)
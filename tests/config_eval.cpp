@@ -0,0 +1,8 @@
+// Listed before config.cpp on the command line when running the tests (see tests/ReadMe.md):
+// The CLI applies config files in reverse order of the command line, so this file is applied after config.cpp
+// and __EVAL may read the configs defined there.
+class eval_tests
+{
+    scalar = __EVAL(getNumber (configFile >> "type_tests" >> "type_scalar") + 1);
+    counter[] = { __COUNTER__, __COUNTER__ };
+};
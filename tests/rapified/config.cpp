@@ -0,0 +1,22 @@
+// Source of config.bin, both are expected to load into the same config tree.
+class rapified_tests
+{
+    class base
+    {
+        text = "base";
+        scalar = 1.5;
+        integer = 42;
+        array[] = { 1, "two", { 3, 4.5 } };
+        class nested
+        {
+            value = 1;
+        };
+    };
+    class external;
+    class derived : base
+    {
+        integer = 7;
+        array[] += { 5 };
+        delete nested;
+    };
+};
@@ -0,0 +1,79 @@
+import ctypes
+import sys
+import threading
+
+# Shares the config of one instance with several others (see sqfvm_share_config)
+# and reads it from all of them concurrently.
+# Usage: python tests/share_config.py path/to/libcsqfvm.(so|dylib|dll)
+
+instance_count = 4
+iterations = 2000
+
+lib = ctypes.CDLL(sys.argv[1])
+log_callback = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_int32, ctypes.c_char_p, ctypes.c_uint32)
+lib.sqfvm_create_instance.restype = ctypes.c_void_p
+lib.sqfvm_create_instance.argtypes = [ctypes.c_void_p, log_callback, ctypes.c_float]
+lib.sqfvm_destroy_instance.argtypes = [ctypes.c_void_p]
+lib.sqfvm_load_config.restype = ctypes.c_int32
+lib.sqfvm_load_config.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_uint32]
+lib.sqfvm_share_config.restype = ctypes.c_int32
+lib.sqfvm_share_config.argtypes = [ctypes.c_void_p, ctypes.c_void_p]
+lib.sqfvm_call.restype = ctypes.c_int32
+lib.sqfvm_call.argtypes = [ctypes.c_void_p, ctypes.c_void_p, ctypes.c_char, ctypes.c_char_p, ctypes.c_uint32]
+
+failures = []
+
+def on_log(user_data, call_data, severity, message, length):
+    # Errors and the output of the checks below are failures, results (-1) and other messages are not.
+    text = message[:length].decode()
+    if 0 <= severity <= 1 or 'MISMATCH' in text:
+        failures.append(text)
+
+callback = log_callback(on_log)
+
+def load_config(instance, contents):
+    return lib.sqfvm_load_config(instance, contents, len(contents))
+
+def call(instance, code):
+    return lib.sqfvm_call(instance, None, b's', code, len(code))
+
+def check(name, actual, expected):
+    if actual != expected:
+        failures.append(name + ': expected ' + str(expected) + ', got ' + str(actual))
+
+source = lib.sqfvm_create_instance(None, callback, 0)
+targets = [lib.sqfvm_create_instance(None, callback, 0) for _ in range(instance_count)]
+
+check('load', load_config(source, b'class shared { flat[] = {1, 2, 3}; nested[] = {1, {2, {3}}, "x"}; class child { value = 1; }; };'), 0)
+check('source invalid', lib.sqfvm_share_config(None, targets[0]), -1)
+check('target invalid', lib.sqfvm_share_config(source, None), -2)
+for target in targets:
+    check('share', lib.sqfvm_share_config(source, target), 0)
+
+# Changes stay local to the instance they are made on
+check('load local', load_config(targets[0], b'class shared { class child { value = 2; }; };'), 0)
+call(source, b'if (getNumber (configFile >> "shared" >> "child" >> "value") != 1) then { diag_log "MISMATCH source"; };')
+call(targets[0], b'if (getNumber (configFile >> "shared" >> "child" >> "value") != 2) then { diag_log "MISMATCH target"; };')
+
+code = (
+    b'for "_i" from 1 to ' + str(iterations).encode() + b' do {'
+    b'    private _flat = getArray (configFile >> "shared" >> "flat");'
+    b'    private _nested = getArray (configFile >> "shared" >> "nested");'
+    b'    _flat pushBack 4; (_nested select 1) pushBack 4;'
+    b'    if !(_flat isEqualTo [1, 2, 3, 4] && _nested isEqualTo [1, [2, [3], 4], "x"]) exitWith { diag_log "MISMATCH"; };'
+    b'};'
+)
+threads = [threading.Thread(target=call, args=(instance, code)) for instance in [source] + targets]
+for thread in threads:
+    thread.start()
+for thread in threads:
+    thread.join()
+call(source, b'if !(getArray (configFile >> "shared" >> "nested") isEqualTo [1, [2, [3]], "x"]) then { diag_log "MISMATCH unmodified"; };')
+
+for instance in [source] + targets:
+    lib.sqfvm_destroy_instance(instance)
+
+for failure in failures:
+    print(failure)
+print(('FAILED' if failures else 'PASSED') + ' (' + str(len(failures)) + ' failure(s))')
+sys.exit(1 if failures else 0)